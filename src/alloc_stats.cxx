@@ -0,0 +1,155 @@
+#include "alloc_stats.h"
+
+#ifdef ALLOC_STATS
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <mutex>
+#include <atomic>
+
+namespace ana {
+
+static const int MAX_STAGES = 32;
+
+struct AllocCounts {
+    uint64_t allocations, bytes;
+};
+
+/// Process wide, as a block may be freed by another thread than the one
+/// which allocated it
+struct LiveCounts {
+    std::atomic<int64_t> live, peak;
+};
+
+// Plain data, so that they are usable from operator new at any time
+static const char* stage_names[MAX_STAGES] = {"other"};
+static std::atomic<int> stage_count(1);
+static thread_local int current_stage = 0;
+static thread_local AllocCounts counts[MAX_STAGES];
+static LiveCounts live_counts[MAX_STAGES];
+
+/// In front of every block, keeping it aligned as malloc's
+struct alignas(16) AllocHeader {
+    uint64_t size;
+    uint32_t stage;
+};
+
+static void* allocate(const size_t size) {
+    AllocHeader* h = static_cast<AllocHeader*>(malloc(sizeof(AllocHeader) + size));
+    if (!h)
+        return NULL;
+    h->size = size;
+    h->stage = current_stage;
+
+    AllocCounts& c = counts[h->stage];
+    c.allocations++;
+    c.bytes += size;
+
+    LiveCounts& l = live_counts[h->stage];
+    const int64_t live = l.live.fetch_add(size, std::memory_order_relaxed) + size;
+    int64_t peak = l.peak.load(std::memory_order_relaxed);
+    while (live > peak && !l.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+    return h + 1;
+}
+
+static void deallocate(void* p) {
+    if (!p)
+        return;
+    AllocHeader* h = static_cast<AllocHeader*>(p) - 1;
+    live_counts[h->stage].live.fetch_sub(h->size, std::memory_order_relaxed);
+    free(h);
+}
+
+int alloc_stage(const char* name) {
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    const int n = stage_count;
+    for (int i = 0; i < n; i++)
+        if (strcmp(stage_names[i], name) == 0)
+            return i;
+    if (n == MAX_STAGES) {
+        std::cerr << "Too many allocation stages, counting " << name << " as other" << std::endl;
+        return 0;
+    }
+    stage_names[n] = name;
+    stage_count = n + 1;
+    return n;
+}
+
+AllocScope::AllocScope(const int stage) : _previous(current_stage) {
+    current_stage = stage;
+}
+
+AllocScope::~AllocScope() {
+    current_stage = _previous;
+}
+
+void alloc_report(const std::string& title) {
+    // Taken before formatting, which allocates itself
+    const int n = stage_count;
+    AllocCounts snapshot[MAX_STAGES];
+    int64_t peaks[MAX_STAGES];
+    for (int i = 0; i < n; i++) {
+        snapshot[i] = counts[i];
+        counts[i].allocations = counts[i].bytes = 0;
+        peaks[i] = live_counts[i].peak.exchange(live_counts[i].live.load(std::memory_order_relaxed),
+                                                std::memory_order_relaxed);
+    }
+
+    std::ostringstream s;
+    s << "Allocations (" << title << "):\n"
+      << std::setw(16) << "stage" << std::setw(14) << "allocations"
+      << std::setw(16) << "bytes" << std::setw(16) << "peak live" << "\n";
+    for (int i = 0; i < n; i++) {
+        const AllocCounts& c = snapshot[i];
+        if (!c.allocations)
+            continue;
+        s << std::setw(16) << stage_names[i] << std::setw(14) << c.allocations
+          << std::setw(16) << c.bytes << std::setw(16) << peaks[i] << "\n";
+    }
+    // One write, so that reports of concurrent processors don't interleave
+    std::cout << s.str() << std::flush;
+}
+
+}
+
+void* operator new(size_t size) {
+    void* p = ana::allocate(size);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) throw() {
+    return ana::allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) throw() {
+    return ana::allocate(size);
+}
+
+void operator delete(void* p) throw() {
+    ana::deallocate(p);
+}
+
+void operator delete[](void* p) throw() {
+    ana::deallocate(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) throw() {
+    ana::deallocate(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) throw() {
+    ana::deallocate(p);
+}
+
+#endif
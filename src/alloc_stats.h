@@ -0,0 +1,54 @@
+#ifndef _ALLOC_STATS_H_
+#define _ALLOC_STATS_H_
+
+#include <string>
+
+#include <a4/types.h>
+
+namespace ana {
+
+// Allocation accounting, built with `./waf configure --alloc-stats`.
+//
+// Global operator new/delete count the allocations, bytes and live bytes of
+// the stage the calling thread is in. ALLOC_STAGE("name") puts the thread in
+// that stage until the end of the enclosing scope; anything allocated outside
+// a stage is counted under "other". Every block remembers the stage which
+// allocated it, so freeing it later lowers that stage's live bytes. Allocations
+// and bytes are counted per thread, i.e. per processor; live and peak live
+// bytes are process wide, as a block may be freed by another thread.
+//
+// Without --alloc-stats the stages compile to nothing.
+
+#ifdef ALLOC_STATS
+
+/// Index of the named stage, registered on first use
+int alloc_stage(const char* name);
+
+class AllocScope {
+    int _previous;
+public:
+    AllocScope(int stage);
+    ~AllocScope();
+};
+
+/// Print the calling thread's counts and the process's peak live bytes since
+/// the last report, and start again
+void alloc_report(const std::string& title);
+
+#define ALLOC_CONCAT_(a, b) a##b
+#define ALLOC_CONCAT(a, b) ALLOC_CONCAT_(a, b)
+#define ALLOC_STAGE(name) \
+    static const int ALLOC_CONCAT(_alloc_stage_, __LINE__) = ::ana::alloc_stage(name); \
+    ::ana::AllocScope ALLOC_CONCAT(_alloc_scope_, __LINE__)(ALLOC_CONCAT(_alloc_stage_, __LINE__))
+
+#else
+
+inline void alloc_report(const std::string&) {}
+
+#define ALLOC_STAGE(name) do {} while (false)
+
+#endif
+
+}
+
+#endif
@@ -8,6 +8,7 @@ using a4::process::utility::vector_of_ptr;
 using a4::process::utility::in_map;
 
 #include "analysis.h"
+#include "alloc_stats.h"
 
 #include <a4/atlas/ntup/photon/Event.pb.h>
 namespace ntup = a4::atlas::ntup::photon;
@@ -29,7 +30,11 @@ namespace ana {
 
 
 void Filter::process(const ntup::Event& event) {
-    ntup::Event new_event(event);
+    ALLOC_STAGE("filter");
+    // Clear() keeps the submessages, so copying into the reused event only
+    // allocates when this one is larger than any before
+    ntup::Event& new_event = _new_event;
+    new_event.CopyFrom(event);
     
     // Discard everything except the first gen_event
     new_event.clear_gen_events();
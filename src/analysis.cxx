@@ -25,9 +25,10 @@ using a4::process::utility::in_map;
 #include "analysis.h"
 #include "config.h"
 
-#include "egammaPIDdefs.h"
 #include "constants.h"
 #include "event_view.h"
+#include "kinematics.h"
+#include "alloc_stats.h"
 
 //using a4::atlas::ntup::photon::Event;
 #include <a4/atlas/ntup/photon/Event.pb.h>
@@ -47,22 +48,78 @@ VariableAxis mass_logbins_full  (VariableAxis::log_bins(200, 10, 3000));
 
 
 
-VariableAxis _ptbins = VariableAxis({
-    //20, 40, 80, 160, 320, 640, 1280
-    0, 100, 250, 500, 750, 1000, 1500, 2000
-}); 
-
-VariableAxis _etabins = VariableAxis({
-    //0., 0.60, 1.37, 1.52, 1.81, 2.37
-    0, 0.6, 0.8, 1.15, 1.37, 1.52, 1.81, 2.01, 2.37, 2.47
-});
-
-
 VariableAxis pt_logbins         (VariableAxis::log_bins(100, 10, 2000));
 VariableAxis bjorken_x_bins     (VariableAxis::log_bins(50,  0.01,  1));
 
 SimpleAxis   eta_bins(100, -2.5, 2.5);
 
+// Histograms with thousands of mostly empty bins. With --sparse-hist they are
+// kept in variation i's SparseStore of the current pass and only made dense
+// when written.
+#define LARGE_H1(i, D, name, bins, min, max, label, x) \
+    do { \
+        if (C._sparse_histograms) \
+            _weights.sparse(i).h1(name, bins, min, max, label).fill((x), D.weight()); \
+        else \
+            D.T<H1>(name)(bins, min, max, label).fill(x); \
+    } while (false)
+
+#define LARGE_H2(i, D, name, xbins, xmin, xmax, xlabel, ybins, ymin, ymax, ylabel, x, y) \
+    do { \
+        if (C._sparse_histograms) \
+            _weights.sparse(i).h2(name, xbins, xmin, xmax, xlabel, \
+                                  ybins, ymin, ymax, ylabel).fill((x), (y), D.weight()); \
+        else \
+            D.T<H2>(name)(xbins, xmin, xmax, xlabel)(ybins, ymin, ymax, ylabel).fill((x), (y)); \
+    } while (false)
+
+// The photon cuts, in cutflow order
+enum PhotonCut {
+    PH_PT, PH_ETA, PH_OQ, PH_CLEAN, PH_LOOSE, PH_TIGHT, PH_ISO, N_PHOTON_CUTS
+};
+
+/// One bit per cut the photon passes
+inline uint32_t photon_cuts(const Photon& ph) {
+    const auto etas2 = abs(ph->etas2());
+    const bool crack = (etas2 >= 1.37 && etas2 <= 1.52) || etas2 >= 2.37;
+    const bool unclean = (ph->oq() & LARBITS_PHOTON_CLEANING) != 0
+                         && (ph->reta() > 0.98
+                             || ph->rphi() > 1.0
+                             || ((ph->oq() & LARBITS_OUTOFTIME_CLUSTER) != 0));
+    const auto& c = ph.corrected();
+    return uint32_t(!(c.pt() <= 25e3))                    << PH_PT
+         | uint32_t(!crack)                               << PH_ETA
+         | uint32_t(!(ph->oq() & OQ_BAD_BITS))            << PH_OQ
+         | uint32_t(!unclean)                             << PH_CLEAN
+         | uint32_t(bool(c.loose()))                      << PH_LOOSE
+         | uint32_t(bool(c.tight()))                      << PH_TIGHT
+         | uint32_t(c.analysis_isolation() < 5000.)       << PH_ISO;
+}
+
+/// Number of cuts, from the first, the photon passes in a row
+inline int passed_cuts(const uint32_t cuts) {
+    return __builtin_ctz(~cuts);
+}
+
+/// The two photons with the highest corrected pt among those passing every
+/// cut up to `last`. Of equal ones the first wins, as in a stable sort.
+inline void leading_photons(const std::vector<Photon>& photons, const std::vector<uint32_t>& cuts,
+                            const PhotonCut last, size_t& lead, size_t& sublead) {
+    lead = sublead = photons.size();
+    double lead_pt = 0, sublead_pt = 0;
+    for (size_t i = 0; i < photons.size(); i++) {
+        if (passed_cuts(cuts[i]) <= last)
+            continue;
+        const double pt = photons[i].corrected().pt();
+        if (lead == photons.size() || pt > lead_pt) {
+            sublead = lead; sublead_pt = lead_pt;
+            lead = i;       lead_pt = pt;
+        } else if (sublead == photons.size() || pt > sublead_pt) {
+            sublead = i;    sublead_pt = pt;
+        }
+    }
+}
+
 const std::unordered_map<int, SampleInfo> resonance_samples = {
     { 105324, {105324, "105324/", 1250, 0.05, 4.725, 9.08 } },
     { 105623, {105623, "105623/", 500, 0.01, 0.075, 82.5 } },
@@ -113,6 +170,22 @@ const SampleInfo* get_sample(const ntup::Event& e) {
 }
 
 void Analysis::process_end_metadata() {
+    // With --stream-samples every block is ended by end_sample(), including
+    // the one of the last sample here. Its metadata comes from the sample's own
+    // counters rather than metadata(), which is what contaminates the blocks
+    // below, so it is correct at any input block boundary. A sample which
+    // continues in the next input simply gets another block; merge_results
+    // adds blocks of the same mc_channel back together.
+    if (C._stream_samples && _current_sample != 0) {
+        end_sample();
+        _current_sample = 0; // The next event starts its sample again
+        return;
+    }
+    
+    _showershapes.flush(_nominal_S);
+    _weights.flush_sparse();
+    alloc_report("sample " + std::to_string(_current_sample));
+    
     // Disabled for the time being because it is broken, producing cross-sample
     // contamination.
     return;
@@ -126,11 +199,46 @@ void Analysis::process_end_metadata() {
     metadata_end_block(m);
 }
 
+namespace {
+
+// kFactorVsMass_DiphoxNLO_mstw2008nlo_iso7GeV_16642_phD3PD000131_v_B_H4_iso_filt.root
+// 13 bins of true m_gg in [0, 1300] GeV, index 0 underflow and 14 overflow.
+// A constant table rather than a TH1D, so that nothing is built at startup.
+const double SMDIPH_MIN = 0, SMDIPH_MAX = 1300;
+const int SMDIPH_BINS = 13;
+
+constexpr double SMDIPH_KFACTOR[SMDIPH_BINS + 2][2] = {
+    {0.77524548769,  0.193811371922},
+    {0.77524548769,  0.193811371922},
+    {1.61900544167,  0.404751360416},
+    {1.64430201054,  0.411075502634},
+    {1.49268329144,  0.373170822859},
+    {1.44546496868,  0.36136624217},
+    {1.31024003029,  0.327560007572},
+    {1.28618884087,  0.321547210217},
+    {1.16020214558,  0.290050536394},
+    {1.09157836437,  0.272894591093},
+    {1.06538069248,  0.26634517312},
+    {1.01491463184,  0.253728657961},
+    {0.994816064835, 0.248704016209},
+    {0.977248132229, 0.244312033057},
+    {1,              0.20},
+};
+
+}
+
 inline void Analysis::get_smdiph_weight(const double mass_gev,
                                          double& w, double& err) {
-    const auto bin = C._smdiph_reweight.FindBin(mass_gev);
-    w = C._smdiph_reweight.GetBinContent(bin);
-    err = C._smdiph_reweight.GetBinError(bin);
+    // Same binning as TAxis::FindBin
+    int bin;
+    if (mass_gev < SMDIPH_MIN)
+        bin = 0;
+    else if (!(mass_gev < SMDIPH_MAX))
+        bin = SMDIPH_BINS + 1;
+    else
+        bin = 1 + int(SMDIPH_BINS * (mass_gev - SMDIPH_MIN) / (SMDIPH_MAX - SMDIPH_MIN));
+    w = SMDIPH_KFACTOR[bin][0];
+    err = SMDIPH_KFACTOR[bin][1];
 }
 
 
@@ -166,12 +274,12 @@ inline void Analysis::make_resonance_plots(
 }
 
 inline void Analysis::make_resonances_plots(
-    const uint32_t number,
+    ObjectStore base, const uint32_t number,
     const ntup::Event& event,
     const Photon& lead, const Photon& sublead,
     const double mgg, const double mgg_true) {
     
-    auto D = S("resonances/");
+    auto D = base("resonances/");
     
     if (_current_resonance) {
         make_resonance_plots(D(_current_resonance->dirname),
@@ -197,7 +305,7 @@ inline void Analysis::make_resonances_plots(
         double lo = 400, hi = 3000;
         int n = 200;
         for (double mass = lo; mass < hi; mass += (hi-lo)/n) {
-            auto D_weighted = S("limit/mgg_");
+            auto D_weighted = base("limit/mgg_");
             D_weighted.mul_weight(ComputeWeight(mgg_true / 1000, mass, 0.1));
             D_weighted.T<H1>(mass).with_axis(mass_logbins, "m_{#gamma#gamma} [GeV]").fill(mgg / 1000);
         }
@@ -232,130 +340,11 @@ void Analysis::plot_cts(ObjectStore D, const ALorentzVector& v1, const ALorentzV
     //Ggg1TeV.SetAlias("xmax", "0.1*exp(abs(nbar))")
 }
         
-template<class Obj>
-void plot_showershapes(ObjectStore D, const Obj& obj) {
-//#define PTETABINS (10, 0, 0.5e6, "p_{T} [GeV]")(10, 0, 2.37, "#eta")
-#define PTETABINS .with_axis(_ptbins, "p_{T} [GeV]").with_axis(_etabins, "#eta_{second layer}")
-#define SS(name, bins, value) \
-{ \
-    D.T<H3>(name)bins PTETABINS .fill((value), obj.pt() / 1000, fabs(obj.etas2())); \
-    if (bit != -1) \
-    { \
-        const unsigned int cut_mask = 1 << bit; \
-        if (obj.isem() & cut_mask) \
-            D.T<H3>("fail/" name)bins PTETABINS .fill((value), obj.pt() / 1000, fabs(obj.etas2())); \
-        else \
-            D.T<H3>("pass/" name)bins PTETABINS .fill((value), obj.pt() / 1000, fabs(obj.etas2())); \
-    } \
-    bit = -1; \
-}
-    
-    D = D("showershapes/");
-    
-    int bit = -1;
-    ////
-    // "HADRONIC"
-    ////
-    
-    SS("Ethad",                          ( 100,      -5000.0,       250000.0, "E_{T} had [MeV]"), obj.ethad());
-    SS("Ethad1",                         ( 100,      -4000.0,       160000.0, "E_{T} had (1st layer) [MeV]"), obj.ethad1());
-    
-    bit = egammaPID::ClusterHadronicLeakage_Photon;
-    SS("Rhad",  (120, -0.1, 0.75, "R_{had}"), obj.rhad());
-    
-    bit = egammaPID::ClusterHadronicLeakage_Photon;
-    SS("Rhad1", (120, -0.01,  0.1, "R_{had} (1st layer)"),  obj.rhad1());
-    
-    ////
-    // "MIDDLE"
-    ////
-    
-    // E237 / E277
-    bit = egammaPID::ClusterMiddleEratio37_Photon;
-    SS("reta",                           (120, 0.9,     1, "R_{#eta}"),  obj.reta());
-    
-    // E233 / E237
-    bit =  egammaPID::ClusterMiddleEratio33_Photon;
-    SS("rphi",                           (120, 0.8,     1, "R_{#phi}"),  obj.rphi());
-    
-    // Width in second sampling
-    bit = egammaPID::ClusterMiddleWidth_Photon;
-    SS("weta2",                          ( 100,        -0.01,           0.06, "w_{#eta} (2nd sampling)"), obj.weta2());
-    
-    ////
-    // "STRIPS"
-    ////
-    
-    // eratio AKA DEmaxs1
-    bit = egammaPID::ClusterStripsDEmaxs1_Photon;
-    SS("Eratio",                         (120, 0.7, 1, "E_{ratio}"), obj.deltae());
-    
-    // Difference of energy between max and min
-    bit = egammaPID::ClusterStripsDeltaE_Photon;
-    SS("DeltaE",                         (60, 0, 500, "#DeltaE [MeV]"), obj.deltae());
-    
-    // E of 2nd max in 1st sampling ~e2tsts1/(1000+const_lumi*et)
-    // AKA: Rmax
-    // Unused in current LowLumi_Photons menu
-    bit =  egammaPID::ClusterStripsDeltaEmax2_Photon;
-    SS("deltaEmax2",                     ( 100,            0,           4.0, "#DeltaE_{max}"), obj.deltaemax2());
-    
-    // "fraction of energy reconstructed in strips"
-    bit = egammaPID::ClusterStripsEratio_Photon;
-    SS("f1",                             ( 100,         -0.05,            0.85, "f_{1}"), obj.f1());
-    SS("f1core",                         ( 100,        -0,            0.6, "f_{1} (core)"), obj.f1core());
-    SS("f3core",                         ( 100,         0,            1.0, "f_{3} (core)"), obj.f3core());
-    
-    //
-    // AKA: fracm
-    bit = egammaPID::ClusterStripsFracm_Photon;
-    SS("fside",                          ( 100,         -0.1,           2.0, "f_{side}"), obj.fside());
-    
-    // "Width in 3 strips"
-    // AKA: weta1/weta1c/w1
-    bit = egammaPID::ClusterStripsWeta1c_Photon;
-    SS("ws3",                            ( 100,            0,           0.85, "w_{#eta} (1st sampling)"), obj.ws3());
-    
-    // "Total width in strips"
-    bit = egammaPID::ClusterStripsWtot_Photon;
-    SS("wstot",                          ( 100,         0.04,           20.0, "w_{total} "), obj.wstot());
-    
-    ////
-    // "OTHER"
-    ////
-    
-    // SS("E033",                        (   1,            0,              0), obj.e033());
-    // SS("E132",                        (   1,            0,              0), obj.e132());
-    // SS("E1152",                       (   1,            0,              0), obj.e1152());
-    
-    // Energy of minimum in shower
-    SS("Emins1",                         ( 100,      -500.0,        5000.0, "E_{min} [MeV]"), obj.emins1());
-    
-    // Finds its way into deltae
-    // First maximum
-    SS("Emaxs1",                         ( 100,            0,       110000.0, "E_{max} [MeV]"), obj.emaxs1());
-    
-    // Finds its way into deltaEmaxs2
-    // Energy of second maximum between max and min in strips
-    SS("Emax2",                          ( 100,            0,        151000.0, "E_{second max} [MeV]"), obj.emax2());
-    
-    // (e2tsts1 - emins1)
-    SS("deltaEs",                        ( 100,       -500.0,        5000.0, "#DeltaE_{s} [MeV]"), obj.deltaes());
-    
-    SS("E233",                           ( 100,      -5000.0,       900000.0, "E233 [MeV]"), obj.e233());
-    SS("E237",                           ( 100,     -15000.0,       900000.0, "E237 [MeV]"), obj.e237());
-    SS("E277",                           ( 100,     -28000.0,      1000000.0, "E277 [MeV]"), obj.e277());
-    
-    
-    // SS("f3",                          (   1,            0,              0), obj.f3());
-    
-    
-    // missing variable (not on D3PD: fracm)
-#undef SS
-}
-
 void Analysis::process(const ntup::Event& event) {
 
+    // Reading and parsing the event count as "other"
+    ALLOC_STAGE("event");
+
     /*
     assert(metadata().mc_channel_size() == 1);
     if (unlikely(metadata().mc_channel(0) != event.mc_channel_number())) {
@@ -368,21 +357,24 @@ void Analysis::process(const ntup::Event& event) {
         event.mc_channel_number() != _current_sample)
         new_sample(event);
     
+    // Everything after the k-factor is filled once per weight variation
     #define PASSED(x) \
-        S.T<Cutflow>("cutflow").passed(x);
+        foreach (auto& D, _weights.stores()) \
+            D.T<Cutflow>("cutflow").passed(x);
         
     #define EFFPLOT(name) \
-        S.T<H1>("eff/mgg_true/" name)(7000, 0, 7e6).fill(mgg_true); \
+        foreach_enumerate (i, auto& D, _weights.stores()) \
+            LARGE_H1(i, D, "eff/mgg_true/" name, 7000, 0, 7e6, "", mgg_true); \
         
     #define EFFPLOT_1(name) \
     do { \
         if (is_mc) { \
             EFFPLOT(name); \
-            if (phtr_1 && phtr_2) { \
-                S.T<H1>("eff/true_lead/pt/" name)(3000, 0, 3e6).fill(phtr_1->pt()); \
-                S.T<H1>("eff/true_lead/eta/" name)(100, -2.5, 2.5).fill(phtr_1->eta()); \
-                S.T<H1>("eff/true_sublead/pt/" name)(3000, 0, 3e6).fill(phtr_2->pt()); \
-                S.T<H1>("eff/true_sublead/eta/" name)(100, -2.5, 2.5).fill(phtr_2->eta()); \
+            if (phtr_1 && phtr_2) foreach_enumerate (i, auto& D, _weights.stores()) { \
+                LARGE_H1(i, D, "eff/true_lead/pt/" name, 3000, 0, 3e6, "", phtr_1->pt()); \
+                D.T<H1>("eff/true_lead/eta/" name)(100, -2.5, 2.5).fill(phtr_1->eta()); \
+                LARGE_H1(i, D, "eff/true_sublead/pt/" name, 3000, 0, 3e6, "", phtr_2->pt()); \
+                D.T<H1>("eff/true_sublead/eta/" name)(100, -2.5, 2.5).fill(phtr_2->eta()); \
             } \
         } \
     } while(false)
@@ -426,6 +418,12 @@ void Analysis::process(const ntup::Event& event) {
         S.mul_weight(pileup_weight);
     }
     
+    _weights.bind(S, rerun_systematics_current ? rerun_systematics_current : "");
+    if (rerun_systematics_current == NULL)
+        _nominal_S = S;
+    
+    ALLOC_STAGE("truth");
+    
     //auto hard_process_photons = vector_of<ana::TruePhoton>(event.photon_truth_particles());
     auto hard_process_photons = vector_of_ptr(event.photon_truth_particles());
     REMOVE_IF(hard_process_photons, ph, !ph->ishardprocphoton());
@@ -477,7 +475,14 @@ void Analysis::process(const ntup::Event& event) {
             w -= err;
         if (systematic("kfac_off"))
             w = 1;
-        S.mul_weight(w);
+        
+        for (WeightSystematics::Index i = 0; i < _weights.size(); i++) {
+            double w_i = w;
+            if      (i == _syst_kfac_up)   w_i = k_factor + k_factor_err;
+            else if (i == _syst_kfac_down) w_i = k_factor - k_factor_err;
+            else if (i == _syst_kfac_off)  w_i = 1;
+            _weights.mul_weight(i, w_i);
+        }
     }
     
     
@@ -528,19 +533,9 @@ void Analysis::process(const ntup::Event& event) {
         return &event.photon_truth_particles(index);
     };
     
-    {
-        // Only compute quantities here which are missing
-        ntup::Event& mutable_event = const_cast<ntup::Event&>(event);
-        foreach (auto& mutable_ph, *mutable_event.mutable_photons())
-            Photon::compute_extra_quantities(mutable_ph);
-    }
-
-    auto good_photons = Photon::make_vector(event.photons());
-    foreach_enumerate (i, auto& ph, good_photons) {
-        auto index = ph->has_original_index() ? ph->original_index() : i;
-        ph.compute_corrections(event, index, *_rescaler);
-    }
-    SORT_KEY (good_photons, ph, -ph->pt());
+    auto good_photons = corrected_photons(event);
+    
+    ALLOC_STAGE("cuts");
     
     if (event.photons_size() < 2) return;
     Photon ph_1, ph_2;
@@ -568,46 +563,50 @@ void Analysis::process(const ntup::Event& event) {
     PASSED("Reco 2#gamma");
     EFFPLOT_1("3_reco");
     
-    S.T<H1>("actualintperxing")(120, 0, 30, "#mu").fill(event.actualintperxing());
-    S.T<H1>("averageintperxing")(120, 0, 30, "#mu").fill(event.averageintperxing());
-    
-    #define CUT(name, o, cut) \
-        REMOVE_IF(good_photons, o, cut); \
-        if (good_photons.size() < 2) return; \
-        { \
-            if (is_mc && C._require_mc_match) { \
-                auto cutfunc = [&](const Photon& o) { return cut; }; \
-                if (cutfunc(ph_1) || cutfunc(ph_2)) \
-                    return; \
-                EFFPLOT_1(name); \
-            } else if (is_mc) { \
-                EFFPLOT_1(name); \
-            } \
-        } \
+    foreach (auto& D, _weights.stores()) {
+        D.T<H1>("actualintperxing")(120, 0, 30, "#mu").fill(event.actualintperxing());
+        D.T<H1>("averageintperxing")(120, 0, 30, "#mu").fill(event.averageintperxing());
+    }
+    
+    // Every cut of every photon in one pass, and how many photons pass the
+    // cutflow up to each cut
+    auto& cuts = _photon_cuts;
+    cuts.clear();
+    size_t passing[N_PHOTON_CUTS + 1] = {0};
+    foreach (const auto& ph, good_photons) {
+        cuts.push_back(photon_cuts(ph));
+        passing[passed_cuts(cuts.back())]++;
+    }
+    for (int c = N_PHOTON_CUTS - 1; c >= 0; c--)
+        passing[c] += passing[c + 1];
+    // passing[c + 1]: photons passing cuts 0...c
+    
+    const uint32_t matched_cuts = is_mc && C._require_mc_match
+                                  ? photon_cuts(ph_1) & photon_cuts(ph_2) : 0;
+    
+    #define CUT(name, cut) \
+        if (passing[cut + 1] < 2) return; \
+        if (is_mc && C._require_mc_match && !(matched_cuts >> cut & 1)) \
+            return; \
+        EFFPLOT_1(name); \
         PASSED(name);
     //plot_boson(S("cut/" name "/"), phtr_1_lv, phtr_2_lv);
     
-    CUT("4_pt", ph, ph.corrected().pt() <= 25e3);
-    
-    CUT("5_eta", ph, abs(ph->etas2()) >= 1.37 && abs(ph->etas2()) <= 1.52
-                     || abs(ph->etas2()) >= 2.37);
+    CUT("4_pt", PH_PT);
+    CUT("5_eta", PH_ETA);
+    CUT("6_oq", PH_OQ);
+    CUT("7_phclean", PH_CLEAN);
     
-    CUT("6_oq", ph, ph->oq() & OQ_BAD_BITS);
-    
-    CUT("7_phclean", ph, ((ph->oq() & LARBITS_PHOTON_CLEANING) != 0
-                          && (ph->reta() > 0.98
-                              || ph->rphi() > 1.0
-                              || ((ph->oq() & LARBITS_OUTOFTIME_CLUSTER) != 0)
-                            )
-                         ));
-    
-    SORT_KEY (good_photons, ph, -ph.corrected().pt());
-    auto lead = good_photons[0], sublead = good_photons[1];
+    size_t i_lead, i_sublead;
+    leading_photons(good_photons, cuts, PH_CLEAN, i_lead, i_sublead);
+    auto lead = good_photons[i_lead], sublead = good_photons[i_sublead];
     
     double mgg = compute_mass(event, lead, sublead);
         
     if (C._write_anatree && rerun_systematics_current == NULL) {
-        ntup::Event this_event;
+        ALLOC_STAGE("anatree");
+        ntup::Event& this_event = _anatree_event;
+        this_event.Clear();
         
         #define COPY(what) if (event.has_##what()) this_event.set_##what(event.what())
         COPY(run_number);
@@ -643,47 +642,54 @@ void Analysis::process(const ntup::Event& event) {
         write(this_event);
     }
     
-    CUT("8_loose", ph, !ph.corrected().loose());
+    CUT("8_loose", PH_LOOSE);
     
     // Choose new leading/subleading since we did another cut        
-    lead = good_photons[0];
-    sublead = good_photons[1];
+    leading_photons(good_photons, cuts, PH_LOOSE, i_lead, i_sublead);
+    lead = good_photons[i_lead];
+    sublead = good_photons[i_sublead];
     
     if (is_mc && C._do_sf_reweighting) {
-        S.mul_weight(lead.scale_factor());
-        S.mul_weight(sublead.scale_factor());
+        _weights.mul_weight(lead.scale_factor());
+        _weights.mul_weight(sublead.scale_factor());
     }
     
     PASSED("preselection");
     
-    if (!lead.corrected().tight() || !sublead.corrected().tight())
+    if (!(cuts[i_lead] >> PH_TIGHT & 1) || !(cuts[i_sublead] >> PH_TIGHT & 1))
         return;
         
-    CUT("9_tight", ph, !ph.corrected().tight());
+    CUT("9_tight", PH_TIGHT);
     
-    //plot_boson(S("2_tight/"), *lead, *sublead);
+    // Once per event, not again in every systematic rerun
+    if (C._do_showershapes && rerun_systematics_current == NULL)
+        foreach_enumerate (i, auto& ph, good_photons)
+            if (passed_cuts(cuts[i]) > PH_TIGHT)
+                _showershapes.fill(*ph, ph.corrected(), _weights.nominal().weight());
     
-    auto isolated = [&](const Photon& ph) {
-        return ph.corrected().analysis_isolation() < 5000.;
-    };
+    //plot_boson(S("2_tight/"), *lead, *sublead);
     
-    if (!isolated(lead) || !isolated(sublead))
+    if (!(cuts[i_lead] >> PH_ISO & 1) || !(cuts[i_sublead] >> PH_ISO & 1))
         return;
     
-    CUT("10_iso", ph, !isolated(ph));
+    CUT("10_iso", PH_ISO);
     
     mgg = compute_mass(event, lead, sublead);
     
-    S.T<H1>("sel_reco_mgg")(7000, 0, 7e3, "m_{#gamma#gamma} [GeV]").fill(mgg / 1000);
-    S.T<H1>("sel_reco_mgg_log")
-        .with_axis(mass_logbins, "m_{#gamma#gamma} [GeV]")
-        .fill(mgg / 1000);
-    S.T<H1>("sel_reco_mgg_log_full")
-        .with_axis(mass_logbins_full, "m_{#gamma#gamma} [GeV]")
-        .fill(mgg / 1000);
+    ALLOC_STAGE("histograms");
     
-    if (is_mc)
-        resolution_plots(mgg, mgg_true);
+    foreach_enumerate (i, auto& D, _weights.stores()) {
+        LARGE_H1(i, D, "sel_reco_mgg", 7000, 0, 7e3, "m_{#gamma#gamma} [GeV]", mgg / 1000);
+        D.T<H1>("sel_reco_mgg_log")
+            .with_axis(mass_logbins, "m_{#gamma#gamma} [GeV]")
+            .fill(mgg / 1000);
+        D.T<H1>("sel_reco_mgg_log_full")
+            .with_axis(mass_logbins_full, "m_{#gamma#gamma} [GeV]")
+            .fill(mgg / 1000);
+        
+        if (is_mc)
+            resolution_plots(i, mgg, mgg_true);
+    }
         
     if (event.larerror() > 1) return;
     PASSED("LarOK");
@@ -698,10 +704,12 @@ void Analysis::process(const ntup::Event& event) {
         
     EFFPLOT_1("11_mass");
     
-    make_resonances_plots(event.mc_channel_number(), event,
-                          lead, sublead, mgg, mgg_true);
-    
-    plot_cts(S("sel_reco_"), lead.lv(), sublead.lv());
+    foreach (auto& D, _weights.stores()) {
+        make_resonances_plots(D, event.mc_channel_number(), event,
+                              lead, sublead, mgg, mgg_true);
+        
+        plot_cts(D("sel_reco_"), lead.lv(), sublead.lv());
+    }
 
     auto plot_gen_x = [](const ntup::Event& event, ObjectStore D) {
         
@@ -718,20 +726,24 @@ void Analysis::process(const ntup::Event& event) {
         D.T<H1>("true_xmax").with_axis(bjorken_x_bins, "x_{max}").fill(xmax);
     };
 
-    if (is_mc) {
-        plot_cts(S("sel_true_"), phtr_1_lv, phtr_2_lv);
-        plot_gen_x(event, S);
+    if (is_mc) foreach (auto& D, _weights.stores()) {
+        plot_cts(D("sel_true_"), phtr_1_lv, phtr_2_lv);
+        plot_gen_x(event, D);
         if (have_parents) {
-            auto D = S(is_gluon_event ? "gluon/" : "quark/");
-            plot_cts(D("sel_true_"), phtr_1_lv, phtr_2_lv);
-            plot_cts(D("sel_reco_"), lead.lv(), sublead.lv());
-            plot_gen_x(event, D);
+            auto P = D(is_gluon_event ? "gluon/" : "quark/");
+            plot_cts(P("sel_true_"), phtr_1_lv, phtr_2_lv);
+            plot_cts(P("sel_reco_"), lead.lv(), sublead.lv());
+            plot_gen_x(event, P);
         }
     }
     
 }
 
 void Analysis::new_sample(const ntup::Event& event) {
+    if (C._stream_samples && rerun_systematics_current == NULL &&
+        _current_sample != 0 && event.mc_channel_number() != _current_sample)
+        end_sample();
+    
     _current_run = event.run_number();
     _current_sample = event.mc_channel_number();
     _simulation = event.issimulation();
@@ -790,6 +802,87 @@ void Analysis::new_sample(const ntup::Event& event) {
     }
 }
 
+/// Inputs are ordered by sample, so once the mc_channel changes nothing more
+/// is filled into the previous one's histograms. Ending the metadata block
+/// here makes the driver write the results out under that sample's metadata
+/// and start from an empty store, instead of holding every sample's
+/// resonances/ and limit/ directories until the end of the job.
+/// The blocks contain the same histogram names, so they merge as usual.
+void Analysis::end_sample() {
+    _showershapes.flush(_nominal_S);
+    _weights.flush_sparse();
+    alloc_report("sample " + std::to_string(_current_sample));
+    
+    a4::atlas::EventMetaData m;
+    m.set_simulation(_simulation);
+    m.add_mc_channel(_current_sample);
+    
+    auto& processing_step = *m.add_processing_steps();
+    processing_step.set_name("pwanalysis");
+    
+    m.set_sum_mc_weights(_sum_mc_weights); _sum_mc_weights = 0;
+    m.set_event_count(_event_count); _event_count = 0;
+    
+    metadata_end_block(m);
+}
+
+Photon::EnergyVariation Analysis::energy_variation() {
+    if (rerun_systematics_current == NULL) return Photon::NOMINAL;
+    if (systematic("escale_down")) return Photon::SCALE_DOWN;
+    if (systematic("escale_up"))   return Photon::SCALE_UP;
+    if (systematic("eres_down"))   return Photon::RES_DOWN;
+    if (systematic("eres_up"))     return Photon::RES_UP;
+    return Photon::NOMINAL;
+}
+
+/// Corrections are the most expensive part of the event. They are computed
+/// once in the nominal pass, systematic reruns of the same event only switch
+/// the cached photons to their energy variation.
+std::vector<Photon> Analysis::corrected_photons(const ntup::Event& event) {
+    ALLOC_STAGE("corrections");
+    
+    const bool same_event = &event == _corrected_event
+                            && event.run_number() == _corrected_run
+                            && event.event_number() == _corrected_event_number;
+    
+    if (rerun_systematics_current == NULL || !same_event) {
+        {
+            // Only compute quantities here which are missing
+            ntup::Event& mutable_event = const_cast<ntup::Event&>(event);
+            foreach (auto& mutable_ph, *mutable_event.mutable_photons())
+                Photon::compute_extra_quantities(mutable_ph);
+        }
+        
+        _corrected_photons = Photon::make_vector(event.photons());
+        foreach_enumerate (i, auto& ph, _corrected_photons) {
+            auto index = ph->has_original_index() ? ph->original_index() : i;
+            
+            if (C._correction_cache) {
+                const auto* cached = C._correction_cache->find(
+                    event.mc_channel_number(), event.run_number(), event.event_number(), index);
+                if (cached && cached->input == correction_input_hash(*ph)) {
+                    ph.restore_corrections(event, index, *cached);
+                    continue;
+                }
+            }
+            
+            ph.compute_corrections(event, index, *_rescaler);
+            if (C._correction_cache)
+                C._correction_cache->add(ph.correction_record(event));
+        }
+        
+        _corrected_event = &event;
+        _corrected_run = event.run_number();
+        _corrected_event_number = event.event_number();
+    }
+    
+    const auto variation = energy_variation();
+    foreach (auto& ph, _corrected_photons)
+        ph.use_energy_variation(variation);
+    
+    return _corrected_photons;
+}
+
 bool Analysis::pass_grl(const ntup::Event& event) {
     if (event.issimulation()) return true;
     return C._grl->pass(event.run_number(), event.lbn());
@@ -807,36 +900,45 @@ double Analysis::compute_mass(const ntup::Event& event, const Photon& lead, cons
     double phi2 = sublead->phi();
     
     double PV_ID = event.primary_vertices(0).z();
-    double mgg = GetCorrectedInvMass(E1, eta1, phi1, E2, eta2, phi2, PV_ID);
+    double mgg = diphoton_mass(PhotonDirection(E1, eta1, phi1, PV_ID),
+                               PhotonDirection(E2, eta2, phi2, PV_ID));
+    
+    if (C._check_mass) {
+        double mgg_root = GetCorrectedInvMass(E1, eta1, phi1, E2, eta2, phi2, PV_ID);
+        if (fabs(mgg*mgg - mgg_root*mgg_root) > root_mass2_tolerance(E1, E2))
+            FATAL("m_gg mismatch: ", mgg, " vs ", mgg_root, " (TLorentzVector)");
+    }
     return mgg;
 }
 
-double Analysis::resolution_plots(double mgg, double mgg_true) {
-    S.T<H1>("sel_mgg_true")(7000, 0, 7e3, "m_{#gamma#gamma} [GeV]").fill(mgg_true/1000.);
+double Analysis::resolution_plots(WeightSystematics::Index i, double mgg, double mgg_true) {
+    auto& D = _weights.stores()[i];
+    
+    LARGE_H1(i, D, "sel_mgg_true", 7000, 0, 7e3, "m_{#gamma#gamma} [GeV]", mgg_true/1000.);
     
-    S.T<H1>("sel_mgg_true_log")
+    D.T<H1>("sel_mgg_true_log")
         .with_axis(mass_logbins, "m_{#gamma#gamma} [GeV]")
         .fill(mgg_true / 1000);
-    S.T<H1>("sel_mgg_true_log_full")
+    D.T<H1>("sel_mgg_true_log_full")
         .with_axis(mass_logbins_full, "m_{#gamma#gamma} [GeV]")
         .fill(mgg_true / 1000);
     
-    S.T<H2>("sel_true_v_reco_mgg")
+    D.T<H2>("sel_true_v_reco_mgg")
         (70, 0, 7e6, "m_{gg} (true)")
         (70, 0, 7e6, "m_{gg} (reco)")
         .fill(mgg_true, mgg);
         
-    S.T<H2>("sel_true_v_reco_mgg_limited")
-        (400, 0, 2e6, "m_{gg} (true)")
-        (400, 0, 2e6, "m_{gg} (reco)")
-        .fill(mgg_true, mgg);
+    LARGE_H2(i, D, "sel_true_v_reco_mgg_limited",
+        400, 0, 2e6, "m_{gg} (true)",
+        400, 0, 2e6, "m_{gg} (reco)",
+        mgg_true, mgg);
         
-    S.T<H2>("sel_true_v_recores_mgg")
+    D.T<H2>("sel_true_v_recores_mgg")
         (70, 0, 7e6, "m_{gg} (true)")
         (200, -100e3, 100e3, "m_{gg} (reco) - m_{gg} (true)")
         .fill(mgg_true, mgg - mgg_true);
         
-    S.T<H2>("sel_true_v_recoresrel_mgg")
+    D.T<H2>("sel_true_v_recoresrel_mgg")
         (70, 0, 7e6, "m_{gg} (true)")
         (400, -0.1, 0.1, "(m_{gg} (reco) - m_{gg} (true)) / m_{gg} (true)")
         .fill(mgg_true, (mgg - mgg_true) / mgg_true);
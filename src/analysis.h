@@ -13,8 +13,9 @@ using a4::store::ObjectStore;
 #include <a4/atlas/EventMetaData.pb.h>
 
 #include "config.h"
-
-class Photon;
+#include "systematics.h"
+#include "event_view.h"
+#include "showershapes.h"
 
 class ALorentzVector;
 
@@ -57,6 +58,26 @@ protected:
     
     const SampleInfo* _current_resonance;
     
+    WeightSystematics _weights;
+    WeightSystematics::Index _syst_kfac_up, _syst_kfac_down, _syst_kfac_off;
+    
+    ShowerShapeBank _showershapes;
+    // S of the last nominal (not rerun_systematics) event, which the shower
+    // shapes are written to
+    ObjectStore _nominal_S;
+    
+    // Corrected photons of the last event, reused by its systematic reruns
+    std::vector<Photon> _corrected_photons;
+    const ntup::Event* _corrected_event;
+    uint32_t _corrected_run, _corrected_event_number;
+    
+    // The --write-anatree event, cleared and refilled for every event so that
+    // its photons, extensions and strings keep their memory
+    ntup::Event _anatree_event;
+    
+    // Cuts passed by each photon of the event, see photon_cuts
+    std::vector<uint32_t> _photon_cuts;
+    
 public:
     static Analysis* construct(const std::string& name, Configuration* c);
 
@@ -66,7 +87,12 @@ public:
           _simulation(false), _is_sm_diphoton_sample(false),
           _current_run(false), _current_sample(false),
           _sum_mc_weights(0), _event_count(0),
-          _current_resonance(NULL)
+          _current_resonance(NULL),
+          _syst_kfac_up(WeightSystematics::NONE),
+          _syst_kfac_down(WeightSystematics::NONE),
+          _syst_kfac_off(WeightSystematics::NONE),
+          _corrected_event(NULL),
+          _corrected_run(0), _corrected_event_number(0)
         
     {
         //set_metadata_behavior(MANUAL_BACKWARD);
@@ -77,9 +103,13 @@ public:
     
     // Called when a new mc_channel is encountered
     void new_sample(const ntup::Event& event);
+    // Write out the results of the finished mc_channel and release them
+    void end_sample();
     bool pass_grl(const ntup::Event& event);
+    Photon::EnergyVariation energy_variation();
+    std::vector<Photon> corrected_photons(const ntup::Event& event);
     double compute_mass(const ntup::Event& event, const Photon& lead, const Photon& sublead) const;
-    double resolution_plots(double mgg, double mgg_true);
+    double resolution_plots(WeightSystematics::Index i, double mgg, double mgg_true);
     
     void get_smdiph_weight(const double mass_gev, double& w, double& err);
     
@@ -89,7 +119,7 @@ public:
         const double mgg, const double mgg_true,
         const SampleInfo* resonance_sample);
     inline void make_resonances_plots(
-        const uint32_t number,
+        ObjectStore base, const uint32_t number,
         const ntup::Event& event,
         const Photon& lead, const Photon& sublead,
         const double mgg, const double mgg_true);
@@ -98,6 +128,8 @@ public:
 };
 
 class Filter : public Analysis {
+    // Reused like _anatree_event
+    ntup::Event _new_event;
 public:
     Filter(Configuration* c) : Analysis(c) {}
     void filter_photons(const ntup::Event& event, ntup::Event& new_event);
@@ -1,4 +1,6 @@
 #include <iostream>
+#include <vector>
+#include <mutex>
 
 #include <a4/application.h>
 
@@ -10,24 +12,89 @@ using ntup::Event;
 using namespace a4::process;
 //using namespace a4::hist;
 
+#include <TList.h>
+#include <TH1.h>
 
 //#include "a4analysis.h"
 #include "external.h"
 
+typedef shared<Root::TPileupReweighting> PileupTool;
+
+PileupTool new_pileup_tool(const std::string& name) {
+    auto pileup_tool = new Root::TPileupReweighting(name.c_str());
+    pileup_tool->UsePeriodConfig("MC11c");
+    pileup_tool->initialize();
+    return PileupTool(pileup_tool);
+}
+
+/// Each processor (one per thread) fills its own tool, without any locking.
+/// When the last one finishes, the shards are merged with
+/// TPileupReweighting::Merge and written out once.
+class PileupShards {
+    std::mutex _mutex;
+    std::vector<PileupTool> _finished;
+    size_t _running;
+
+public:
+    PileupShards() : _running(0) {}
+
+    PileupTool start(const std::string& name) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _running++;
+        return new_pileup_tool(name);
+    }
+
+    /// ROOT isn't thread safe when creating histograms, so the (rare) lookups
+    /// which may create one are serialised. Filling needs no lock.
+    TH1* histogram(PileupTool shard, const int run, const int channel) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return shard->GetFillHistogram("pileup", run, channel);
+    }
+
+    void finish(PileupTool shard, const std::string& output_name) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _finished.push_back(shard);
+        if (--_running != 0)
+            return;
+
+        PileupTool merged = _finished[0];
+        TList others;
+        for (size_t i = 1; i < _finished.size(); i++)
+            others.Add(_finished[i].get());
+        merged->Merge(&others);
+
+        merged->WriteToFile(output_name);
+        _finished.clear();
+    }
+};
+
+PileupShards shards;
+
 class PileupProcessor : public ProcessorOf<Event> {
-public: 
+    // Histogram of the last (run, channel), which rarely changes between events
+    TH1* _hist;
+    int _run, _channel;
+
+public:
+    PileupProcessor() : _hist(NULL), _run(0), _channel(0) {}
 
     virtual void process(const Event& event) {
-        pileup_tool->Fill(event.run_number(), 
-                         event.mc_channel_number(), 
-                         event.mc_event_weight(), 
-                         event.averageintperxing());
+        const int run = event.run_number(),
+                  channel = event.mc_channel_number();
+        if (!_hist || run != _run || channel != _channel) {
+            _hist = shards.histogram(pileup_tool, run, channel);
+            _run = run;
+            _channel = channel;
+        }
+        // Float_t, as TPileupReweighting::Fill would
+        _hist->Fill(Float_t(event.averageintperxing()),
+                    Float_t(event.mc_event_weight()));
     }
 
     virtual ~PileupProcessor() {
-        pileup_tool->WriteToFile(output_name);
+        shards.finish(pileup_tool, output_name);
     }
-    
+
     shared<Root::TPileupReweighting> pileup_tool;
     std::string output_name;
 };
@@ -35,25 +102,17 @@ public:
 class PileupConfiguration : public ConfigurationOf<PileupProcessor> {
 public:
     std::string output_name;
-      
-    
+
+
     virtual void add_options(po::options_description_easy_init opt) {
         opt("output-name,O", po::value(&output_name), "output filename");
     }
 
     virtual void read_arguments(po::variables_map& arguments) {
     }
-    
+
     virtual void setup_processor(PileupProcessor& g) {
-        // Rough check against multiple runs
-        static int count = 0;
-        count++;
-        assert(count == 1);
-        
-        auto pileup_tool = new Root::TPileupReweighting("pileup_reweighting");
-        pileup_tool->UsePeriodConfig("MC11c");
-        pileup_tool->initialize();
-        g.pileup_tool.reset(pileup_tool);
+        g.pileup_tool = shards.start("pileup_reweighting");
         g.output_name = output_name;
     }
 };
@@ -61,4 +120,3 @@ public:
 int main(int argc, const char** argv) {
     return a4_main_configuration<PileupConfiguration>(argc, argv);
 }
-
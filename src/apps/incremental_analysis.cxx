@@ -0,0 +1,313 @@
+// Run the analysis file by file, only on inputs which changed since last time
+//
+// Every input gets its own partial result in the work directory, recorded in
+// a manifest with a fingerprint of the file (size and modification time, or
+// its contents with --hash-contents) and of the analysis: its executable's
+// contents and its options, including the contents of any file they name
+// (GRL, pileup files, ...). On a rerun,
+// inputs whose fingerprint didn't change keep their partial result, the others
+// are (re)processed, and all partial results are merged with merge_results.
+// The inputs are handed out from one queue, largest first, so one huge sample
+// doesn't hold up the end. The unit of work is a whole file: a4 owns the event
+// loop and doesn't expose its block boundaries, so a file can't be split.
+// Everything after "--" is passed to the analysis:
+//
+//   incremental_analysis -w work/ -o merged.a4 -j 8 data/*.a4 -- --grl grl.xml --rw-pileup
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <map>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <algorithm>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boost/program_options.hpp>
+namespace po = boost::program_options;
+
+#include <a4/types.h>
+
+/// FNV-1a, continuing from hash h
+uint64_t fnv1a(const void* data, const size_t size, uint64_t h = 14695981039346656037ull) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+uint64_t hash_string(const std::string& s, const uint64_t h) {
+    return fnv1a(s.data(), s.size() + 1, h); // including the terminator, to separate strings
+}
+
+uint64_t hash_contents(const std::string& path, uint64_t h) {
+    std::ifstream in(path, std::ios::binary);
+    char buf[1 << 16];
+    while (in.read(buf, sizeof(buf)) || in.gcount())
+        h = fnv1a(buf, in.gcount(), h);
+    return h;
+}
+
+bool is_file(const std::string& path, struct stat& st) {
+    return stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode);
+}
+
+/// The analysis options, and the contents of the files they name
+/// Path of the executable the shell runs as name: name itself if it has a '/',
+/// else the first match in $PATH, or "" if there is none
+std::string find_executable(const std::string& name) {
+    if (name.find('/') != std::string::npos)
+        return name;
+    const char* path = getenv("PATH");
+    std::istringstream dirs(path ? path : "");
+    std::string dir;
+    while (std::getline(dirs, dir, ':')) {
+        const std::string candidate = (dir.empty() ? "." : dir) + "/" + name;
+        struct stat st;
+        if (is_file(candidate, st) && access(candidate.c_str(), X_OK) == 0)
+            return candidate;
+    }
+    return "";
+}
+
+/// Fingerprint of the analysis, executable at analysis_path, and its options
+uint64_t config_fingerprint(const std::string& analysis, const std::string& analysis_path,
+                            const std::vector<std::string>& args) {
+    uint64_t h = hash_string(analysis, fnv1a(NULL, 0));
+    // A rebuilt analysis invalidates every partial result
+    h = hash_contents(analysis_path, h);
+    foreach (const auto& arg, args) {
+        h = hash_string(arg, h);
+        // Both "--grl file" and "--grl=file"
+        const size_t eq = arg.find('=');
+        const std::string value = eq == std::string::npos ? arg : arg.substr(eq + 1);
+        struct stat st;
+        if (is_file(value, st))
+            h = hash_contents(value, h);
+    }
+    return h;
+}
+
+uint64_t input_fingerprint(const std::string& path, const bool contents, uint64_t h) {
+    struct stat st;
+    if (!is_file(path, st))
+        return 0;
+    h = hash_string(path, h);
+    if (contents)
+        return hash_contents(path, h);
+    const int64_t values[] = {int64_t(st.st_size), int64_t(st.st_mtim.tv_sec), int64_t(st.st_mtim.tv_nsec)};
+    return fnv1a(values, sizeof(values), h);
+}
+
+std::string hex(const uint64_t h) {
+    std::ostringstream s;
+    s << std::hex << std::setw(16) << std::setfill('0') << h;
+    return s.str();
+}
+
+/// Single quoted for the shell
+std::string quote(const std::string& s) {
+    std::string result = "'";
+    foreach (const char c, s) {
+        if (c == '\'') result += "'\\''";
+        else           result += c;
+    }
+    return result + "'";
+}
+
+struct Entry {
+    std::string input, fingerprint, partial;
+};
+
+/// Backslash escapes for the separators of the manifest
+std::string escape(const std::string& s) {
+    std::string result;
+    foreach (const char c, s) {
+        if      (c == '\\') result += "\\\\";
+        else if (c == '\t') result += "\\t";
+        else if (c == '\n') result += "\\n";
+        else                result += c;
+    }
+    return result;
+}
+
+std::string unescape(const std::string& s) {
+    std::string result;
+    for (size_t i = 0; i < s.size(); i++) {
+        if (s[i] != '\\' || i + 1 == s.size()) {
+            result += s[i];
+            continue;
+        }
+        const char c = s[++i];
+        result += c == 't' ? '\t' : c == 'n' ? '\n' : c;
+    }
+    return result;
+}
+
+/// input, fingerprint and partial separated by tabs, one per line
+std::map<std::string, Entry> read_manifest(const std::string& path) {
+    std::map<std::string, Entry> manifest;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        const size_t a = line.find('\t'), b = line.find('\t', a + 1);
+        if (a == std::string::npos || b == std::string::npos)
+            continue;
+        Entry e;
+        e.input = unescape(line.substr(0, a));
+        e.fingerprint = line.substr(a + 1, b - a - 1);
+        e.partial = unescape(line.substr(b + 1));
+        manifest[e.input] = e;
+    }
+    return manifest;
+}
+
+void write_manifest(const std::string& path, const std::vector<Entry>& entries) {
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream out(tmp);
+        foreach (const auto& e, entries)
+            out << escape(e.input) << "\t" << e.fingerprint << "\t" << escape(e.partial) << "\n";
+    }
+    if (rename(tmp.c_str(), path.c_str()) != 0)
+        std::cerr << "Could not write " << path << std::endl;
+}
+
+int main(int argc, const char** argv) {
+    std::string work_dir, output, analysis, merge;
+    std::vector<std::string> inputs;
+    size_t jobs;
+    bool contents;
+
+    // Everything after "--" belongs to the analysis
+    int own_argc = argc;
+    std::vector<std::string> analysis_args;
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "--") {
+            own_argc = i;
+            analysis_args.assign(argv + i + 1, argv + argc);
+            break;
+        }
+    }
+
+    po::options_description options("incremental_analysis options");
+    options.add_options()
+        ("help,h", "show this help")
+        ("work-dir,w", po::value(&work_dir)->default_value("incremental"), "directory for the manifest and partial results")
+        ("output,o", po::value(&output)->default_value("merged.a4"), "merged results")
+        ("jobs,j", po::value(&jobs)->default_value(std::thread::hardware_concurrency()), "number of analysis processes at once")
+        ("analysis", po::value(&analysis)->default_value("analysis"), "analysis executable")
+        ("merge", po::value(&merge)->default_value("merge_results"), "merge_results executable")
+        ("hash-contents", po::bool_switch(&contents)->default_value(false), "fingerprint inputs by their contents instead of size and modification time")
+        ("input", po::value(&inputs), "input files");
+
+    po::positional_options_description positional;
+    positional.add("input", -1);
+
+    po::variables_map arguments;
+    po::store(po::command_line_parser(own_argc, argv)
+              .options(options).positional(positional).run(), arguments);
+    po::notify(arguments);
+
+    if (arguments.count("help") || inputs.empty()) {
+        std::cout << options << std::endl;
+        return 1;
+    }
+    if (jobs == 0) jobs = 1;
+
+    mkdir(work_dir.c_str(), 0755);
+    const std::string manifest_path = work_dir + "/manifest";
+    const auto previous = read_manifest(manifest_path);
+    const std::string analysis_path = find_executable(analysis);
+    struct stat st;
+    if (!is_file(analysis_path, st)) {
+        std::cerr << "No such analysis executable: " << analysis << std::endl;
+        return 1;
+    }
+    const uint64_t config = config_fingerprint(analysis, analysis_path, analysis_args);
+
+    std::string common = quote(analysis);
+    foreach (const auto& arg, analysis_args)
+        common += " " + quote(arg);
+
+    // Decide what needs processing
+    std::vector<Entry> entries;
+    std::vector<std::pair<size_t, uint64_t>> todo; // entry, size
+    foreach (const auto& input, inputs) {
+        const uint64_t fingerprint = input_fingerprint(input, contents, config);
+        if (!fingerprint) {
+            std::cerr << "No such input file: " << input << std::endl;
+            return 1;
+        }
+        Entry e;
+        e.input = input;
+        e.fingerprint = hex(fingerprint);
+        e.partial = work_dir + "/" + hex(fnv1a(input.data(), input.size())) + ".a4";
+
+        struct stat st;
+        auto i = previous.find(input);
+        if (i == previous.end() || i->second.fingerprint != e.fingerprint || !is_file(e.partial, st)) {
+            stat(input.c_str(), &st);
+            todo.push_back(std::make_pair(entries.size(), uint64_t(st.st_size)));
+        }
+        entries.push_back(e);
+    }
+    std::cout << todo.size() << " of " << inputs.size() << " inputs to process" << std::endl;
+
+    // Run the analysis on each of them, largest first
+    std::stable_sort(todo.begin(), todo.end(),
+                     [](const std::pair<size_t, uint64_t>& a, const std::pair<size_t, uint64_t>& b) {
+                         return a.second > b.second;
+                     });
+    std::mutex mutex;
+    size_t next = 0;
+    std::vector<bool> failed(entries.size(), false);
+    auto worker = [&]() {
+        while (true) {
+            size_t i;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (next == todo.size())
+                    return;
+                i = todo[next++].first;
+            }
+            const Entry& e = entries[i];
+            const std::string command = common + " -r " + quote(e.partial) + " " + quote(e.input);
+            if (std::system(command.c_str()) != 0) {
+                std::lock_guard<std::mutex> lock(mutex);
+                std::cerr << "Failed: " << command << std::endl;
+                failed[i] = true;
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < jobs; i++)
+        threads.push_back(std::thread(worker));
+    foreach (auto& t, threads)
+        t.join();
+
+    // Failed inputs stay out of the manifest, so they are retried next time
+    std::vector<Entry> done;
+    for (size_t i = 0; i < entries.size(); i++)
+        if (!failed[i])
+            done.push_back(entries[i]);
+    write_manifest(manifest_path, done);
+    if (done.size() != entries.size()) {
+        std::cerr << entries.size() - done.size() << " inputs failed, not merging" << std::endl;
+        return 1;
+    }
+
+    std::string command = quote(merge) + " -j " + std::to_string(jobs) + " -o " + quote(output);
+    foreach (const auto& e, done)
+        command += " " + quote(e.partial);
+    return std::system(command.c_str()) == 0 ? 0 : 1;
+}
@@ -0,0 +1,340 @@
+// Merge many analysis result files (histograms, cutflows) into one.
+//
+// Inputs are read concurrently and combined by a tree reduction: a worker
+// either reads the next input or merges two partial results, so nothing is
+// ever merged into one ever-growing object serially. At most --max-pending
+// partial results are held in memory at once.
+//
+// Results stay split by metadata block: blocks of the same sample (mc_channel,
+// or data) are merged, their metadata field by field as its (a4.io.merge)
+// options say (event counts and MC weights added, runs, lumiblocks, periods
+// and processing steps united), and each is written out again under its
+// merged metadata.
+//
+//   merge_results -j 8 -o merged.a4 job_*.a4
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Message;
+using google::protobuf::Reflection;
+
+#include <boost/program_options.hpp>
+namespace po = boost::program_options;
+
+#include <a4/types.h>
+#include <a4/input_stream.h>
+#include <a4/output_stream.h>
+#include <a4/message.h>
+#include <a4/io/A4.pb.h>
+#include <a4/object_store.h>
+using a4::store::ObjectBackStore;
+
+#include <a4/atlas/EventMetaData.pb.h>
+using a4::atlas::EventMetaData;
+
+/// Value of element i of a repeated field, as a string to compare elements by
+std::string repeated_key(const Message& m, const FieldDescriptor* f, const int i) {
+    const Reflection* r = m.GetReflection();
+    switch (f->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:   return std::to_string(r->GetRepeatedInt32(m, f, i));
+    case FieldDescriptor::CPPTYPE_INT64:   return std::to_string(r->GetRepeatedInt64(m, f, i));
+    case FieldDescriptor::CPPTYPE_UINT32:  return std::to_string(r->GetRepeatedUInt32(m, f, i));
+    case FieldDescriptor::CPPTYPE_UINT64:  return std::to_string(r->GetRepeatedUInt64(m, f, i));
+    case FieldDescriptor::CPPTYPE_DOUBLE: {
+        // Bit for bit, to_string would round
+        const double x = r->GetRepeatedDouble(m, f, i);
+        return std::string(reinterpret_cast<const char*>(&x), sizeof(x));
+    }
+    case FieldDescriptor::CPPTYPE_FLOAT: {
+        // Bit for bit, to_string would round
+        const float x = r->GetRepeatedFloat(m, f, i);
+        return std::string(reinterpret_cast<const char*>(&x), sizeof(x));
+    }
+    case FieldDescriptor::CPPTYPE_BOOL:    return std::to_string(r->GetRepeatedBool(m, f, i));
+    case FieldDescriptor::CPPTYPE_ENUM:    return std::to_string(r->GetRepeatedEnum(m, f, i)->number());
+    case FieldDescriptor::CPPTYPE_STRING:  return r->GetRepeatedString(m, f, i);
+    case FieldDescriptor::CPPTYPE_MESSAGE: return r->GetRepeatedMessage(m, f, i).SerializeAsString();
+    }
+    FATAL("Unknown type of field ", f->full_name());
+}
+
+/// Append element i of repeated field f of from to the same field of to
+void add_repeated(Message& to, const Message& from, const FieldDescriptor* f, const int i) {
+    const Reflection* r = from.GetReflection();
+    switch (f->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:   r->AddInt32(&to, f, r->GetRepeatedInt32(from, f, i)); return;
+    case FieldDescriptor::CPPTYPE_INT64:   r->AddInt64(&to, f, r->GetRepeatedInt64(from, f, i)); return;
+    case FieldDescriptor::CPPTYPE_UINT32:  r->AddUInt32(&to, f, r->GetRepeatedUInt32(from, f, i)); return;
+    case FieldDescriptor::CPPTYPE_UINT64:  r->AddUInt64(&to, f, r->GetRepeatedUInt64(from, f, i)); return;
+    case FieldDescriptor::CPPTYPE_DOUBLE:  r->AddDouble(&to, f, r->GetRepeatedDouble(from, f, i)); return;
+    case FieldDescriptor::CPPTYPE_FLOAT:   r->AddFloat(&to, f, r->GetRepeatedFloat(from, f, i)); return;
+    case FieldDescriptor::CPPTYPE_BOOL:    r->AddBool(&to, f, r->GetRepeatedBool(from, f, i)); return;
+    case FieldDescriptor::CPPTYPE_ENUM:    r->AddEnum(&to, f, r->GetRepeatedEnum(from, f, i)); return;
+    case FieldDescriptor::CPPTYPE_STRING:  r->AddString(&to, f, r->GetRepeatedString(from, f, i)); return;
+    case FieldDescriptor::CPPTYPE_MESSAGE: r->AddMessage(&to, f)->CopyFrom(r->GetRepeatedMessage(from, f, i)); return;
+    }
+    FATAL("Unknown type of field ", f->full_name());
+}
+
+/// Add a numeric field of from to that of to
+void add_scalar(Message& to, const Message& from, const FieldDescriptor* f) {
+    const Reflection* r = from.GetReflection();
+    switch (f->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:  r->SetInt32(&to, f, r->GetInt32(to, f) + r->GetInt32(from, f)); return;
+    case FieldDescriptor::CPPTYPE_INT64:  r->SetInt64(&to, f, r->GetInt64(to, f) + r->GetInt64(from, f)); return;
+    case FieldDescriptor::CPPTYPE_UINT32: r->SetUInt32(&to, f, r->GetUInt32(to, f) + r->GetUInt32(from, f)); return;
+    case FieldDescriptor::CPPTYPE_UINT64: r->SetUInt64(&to, f, r->GetUInt64(to, f) + r->GetUInt64(from, f)); return;
+    case FieldDescriptor::CPPTYPE_DOUBLE: r->SetDouble(&to, f, r->GetDouble(to, f) + r->GetDouble(from, f)); return;
+    case FieldDescriptor::CPPTYPE_FLOAT:  r->SetFloat(&to, f, r->GetFloat(to, f) + r->GetFloat(from, f)); return;
+    default: FATAL("Cannot add field ", f->full_name());
+    }
+}
+
+/// Copy a field which is not repeated from from to to
+void copy_field(Message& to, const Message& from, const FieldDescriptor* f) {
+    const Reflection* r = from.GetReflection();
+    switch (f->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:   r->SetInt32(&to, f, r->GetInt32(from, f)); return;
+    case FieldDescriptor::CPPTYPE_INT64:   r->SetInt64(&to, f, r->GetInt64(from, f)); return;
+    case FieldDescriptor::CPPTYPE_UINT32:  r->SetUInt32(&to, f, r->GetUInt32(from, f)); return;
+    case FieldDescriptor::CPPTYPE_UINT64:  r->SetUInt64(&to, f, r->GetUInt64(from, f)); return;
+    case FieldDescriptor::CPPTYPE_DOUBLE:  r->SetDouble(&to, f, r->GetDouble(from, f)); return;
+    case FieldDescriptor::CPPTYPE_FLOAT:   r->SetFloat(&to, f, r->GetFloat(from, f)); return;
+    case FieldDescriptor::CPPTYPE_BOOL:    r->SetBool(&to, f, r->GetBool(from, f)); return;
+    case FieldDescriptor::CPPTYPE_ENUM:    r->SetEnum(&to, f, r->GetEnum(from, f)); return;
+    case FieldDescriptor::CPPTYPE_STRING:  r->SetString(&to, f, r->GetString(from, f)); return;
+    case FieldDescriptor::CPPTYPE_MESSAGE: r->MutableMessage(&to, f)->CopyFrom(r->GetMessage(from, f)); return;
+    }
+    FATAL("Unknown type of field ", f->full_name());
+}
+
+/// Merge the metadata of two blocks of the same sample, each field as its
+/// (a4.io.merge) option says: MERGE_ADD fields are added, MERGE_UNION and
+/// MERGE_APPEND ones united (appending would repeat the processing step of
+/// every job once per merged input), and the rest kept from the first block,
+/// or taken from the second if only it has them.
+void merge_metadata_fields(Message& to, const Message& from) {
+    const Reflection* r = from.GetReflection();
+    const auto* descriptor = from.GetDescriptor();
+    for (int n = 0; n < descriptor->field_count(); n++) {
+        const FieldDescriptor* f = descriptor->field(n);
+        const auto method = f->options().GetExtension(a4::io::merge);
+
+        if (f->is_repeated()) {
+            if (method != a4::io::MERGE_UNION && method != a4::io::MERGE_APPEND
+                    && r->FieldSize(to, f) != 0)
+                continue;
+            std::set<std::string> present;
+            for (int i = 0; i < r->FieldSize(to, f); i++)
+                present.insert(repeated_key(to, f, i));
+            for (int i = 0; i < r->FieldSize(from, f); i++)
+                if (present.insert(repeated_key(from, f, i)).second)
+                    add_repeated(to, from, f, i);
+
+        } else if (!r->HasField(from, f)) {
+            continue;
+
+        } else if (method == a4::io::MERGE_ADD) {
+            add_scalar(to, from, f);
+
+        } else if (!r->HasField(to, f)) {
+            copy_field(to, from, f);
+        }
+    }
+}
+
+// The a4 store does the per-object work: objects with the same name are
+// added with their own operator+=, which adds the bins directly when the
+// binning is identical.
+
+/// The objects of one sample, and its metadata
+struct Block {
+    bool has_metadata;
+    EventMetaData metadata;
+    shared<ObjectBackStore> objects;
+
+    Block() : has_metadata(false), objects(new ObjectBackStore()) {}
+
+    void merge_metadata(const EventMetaData& m) {
+        if (!has_metadata) {
+            metadata = m;
+            has_metadata = true;
+            return;
+        }
+        merge_metadata_fields(metadata, m);
+    }
+
+    void merge(const Block& o) {
+        objects->merge(*o.objects);
+        if (o.has_metadata)
+            merge_metadata(o.metadata);
+    }
+};
+
+/// Blocks keyed by sample; "" for objects outside any metadata block
+typedef std::map<std::string, Block> Blocks;
+typedef shared<Blocks> Results;
+
+std::string sample_key(const EventMetaData& m) {
+    if (!m.simulation())
+        return "data";
+    std::string key = "mc";
+    foreach (const uint32_t channel, m.mc_channel())
+        key += " " + std::to_string(channel);
+    return key;
+}
+
+Results read_results(const std::string& path) {
+    a4::io::InputStream in(path);
+    Results results(new Blocks());
+    Block* block = NULL;
+    while (shared<a4::io::A4Message> msg = in.next()) {
+        if (in.new_metadata()) {
+            const EventMetaData* m = in.current_metadata().as<EventMetaData>();
+            if (!m)
+                FATAL(path, ": metadata is not EventMetaData");
+            block = &(*results)[sample_key(*m)];
+            block->merge_metadata(*m);
+        }
+        if (!block)
+            block = &(*results)[""];
+        block->objects->from_message(*msg);
+    }
+    if (!in.good())
+        FATAL("Could not read ", path);
+    return results;
+}
+
+void merge_results(Blocks& a, const Blocks& b) {
+    foreach (const auto& i, b)
+        a[i.first].merge(i.second);
+}
+
+void write_results(const Results& results, const std::string& path) {
+    a4::io::OutputStream out(path, "merge_results");
+    // Metadata after its objects, as the analysis writes its results. Objects
+    // without metadata go last, so that they don't join the next block.
+    foreach (const auto& i, *results) {
+        if (i.first.empty())
+            continue;
+        i.second.objects->to_stream(out);
+        out.metadata(i.second.metadata);
+    }
+    const auto unlabelled = results->find("");
+    if (unlabelled != results->end())
+        unlabelled->second.objects->to_stream(out);
+    out.close();
+}
+
+class TreeMerge {
+    std::mutex _mutex;
+    std::condition_variable _changed;
+
+    std::deque<std::string> _inputs;
+    std::deque<Results> _pending;
+    size_t _busy, _max_pending;
+
+public:
+    TreeMerge(const std::vector<std::string>& inputs, size_t max_pending)
+        : _inputs(inputs.begin(), inputs.end()), _busy(0), _max_pending(max_pending) {}
+
+    void worker() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            // Prefer merging: it frees memory, reading allocates it
+            if (_pending.size() >= 2) {
+                Results a = _pending.front(); _pending.pop_front();
+                Results b = _pending.front(); _pending.pop_front();
+                _busy++;
+                lock.unlock();
+
+                merge_results(*a, *b);
+                b.reset();
+
+                lock.lock();
+                _busy--;
+                _pending.push_back(a);
+                _changed.notify_all();
+
+            } else if (!_inputs.empty() && _pending.size() + _busy < _max_pending) {
+                const std::string path = _inputs.front(); _inputs.pop_front();
+                _busy++;
+                lock.unlock();
+
+                Results r = read_results(path);
+
+                lock.lock();
+                _busy--;
+                _pending.push_back(r);
+                _changed.notify_all();
+
+            } else if (_inputs.empty() && _busy == 0 && _pending.size() <= 1) {
+                _changed.notify_all();
+                return;
+
+            } else {
+                _changed.wait(lock);
+            }
+        }
+    }
+
+    Results run(size_t jobs) {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < jobs; i++)
+            threads.push_back(std::thread(&TreeMerge::worker, this));
+        foreach (auto& t, threads)
+            t.join();
+
+        if (_pending.empty())
+            return Results(new Blocks());
+        return _pending.front();
+    }
+};
+
+int main(int argc, const char** argv) {
+    std::string output;
+    std::vector<std::string> inputs;
+    size_t jobs, max_pending;
+
+    po::options_description options("merge_results options");
+    options.add_options()
+        ("help,h", "show this help")
+        ("output,o", po::value(&output)->default_value("merged.a4"), "output filename")
+        ("jobs,j", po::value(&jobs)->default_value(std::thread::hardware_concurrency()), "number of threads")
+        ("max-pending", po::value(&max_pending)->default_value(0), "maximum partial results in memory (default: 2 * jobs)")
+        ("input", po::value(&inputs), "input files");
+
+    po::positional_options_description positional;
+    positional.add("input", -1);
+
+    po::variables_map arguments;
+    po::store(po::command_line_parser(argc, argv)
+              .options(options).positional(positional).run(), arguments);
+    po::notify(arguments);
+
+    if (arguments.count("help") || inputs.empty()) {
+        std::cout << options << std::endl;
+        return 1;
+    }
+
+    if (jobs == 0) jobs = 1;
+    // Two per thread so that merges never starve waiting for reads
+    if (max_pending < 2) max_pending = 2 * jobs;
+
+    TreeMerge merge(inputs, max_pending);
+    write_results(merge.run(jobs), output);
+
+    std::cout << "Merged " << inputs.size() << " files into " << output << std::endl;
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Rewrite events keeping only the fields the analysis reads (proto/slim.proto)
+//
+// The output events are still a4.atlas.ntup.photon.Event, so the analysis
+// runs on them unchanged; they are just much smaller to read and parse.
+//
+//   slim_events -o slim.a4 input.a4
+
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <a4/application.h>
+
+#include <a4/atlas/ntup/photon/Event.pb.h>
+namespace ntup = a4::atlas::ntup::photon;
+
+#include <proto/slim.pb.h>
+
+using ntup::Event;
+using google::protobuf::Message;
+using google::protobuf::Reflection;
+using google::protobuf::Descriptor;
+using google::protobuf::FieldDescriptor;
+
+using namespace a4::process;
+
+/// Fields of a message type to keep, and what to keep of the ones which are
+/// messages themselves. Built once by matching the slim schema's field names.
+class Projection {
+    std::unordered_set<const FieldDescriptor*> _keep;
+    std::unordered_map<const FieldDescriptor*, shared<Projection>> _messages;
+
+public:
+    Projection(const Descriptor* full, const Descriptor* slim) {
+        for (int i = 0; i < slim->field_count(); i++) {
+            const FieldDescriptor* s = slim->field(i);
+            const FieldDescriptor* f = full->FindFieldByName(s->name());
+            if (!f)
+                FATAL("Slim field ", s->full_name(), " is not in ", full->full_name());
+            if (f->is_repeated() != s->is_repeated() ||
+                (f->type() == FieldDescriptor::TYPE_MESSAGE) != (s->type() == FieldDescriptor::TYPE_MESSAGE))
+                FATAL("Slim field ", s->full_name(), " doesn't match ", f->full_name());
+
+            _keep.insert(f);
+            if (f->type() == FieldDescriptor::TYPE_MESSAGE)
+                _messages[f].reset(new Projection(f->message_type(), s->message_type()));
+        }
+    }
+
+    /// Clear everything not in the projection, in place
+    void apply(Message& m) const {
+        const Reflection* r = m.GetReflection();
+        r->MutableUnknownFields(&m)->Clear();
+
+        std::vector<const FieldDescriptor*> present;
+        r->ListFields(m, &present);
+        foreach (const FieldDescriptor* f, present) {
+            if (!_keep.count(f)) {
+                r->ClearField(&m, f);
+                continue;
+            }
+            auto i = _messages.find(f);
+            if (i == _messages.end())
+                continue;
+            if (f->is_repeated()) {
+                for (int j = 0; j < r->FieldSize(m, f); j++)
+                    i->second->apply(*r->MutableRepeatedMessage(&m, f, j));
+            } else {
+                i->second->apply(*r->MutableMessage(&m, f));
+            }
+        }
+    }
+};
+
+class SlimProcessor : public ProcessorOf<Event> {
+public:
+    shared<const Projection> projection;
+    uint64_t bytes_in, bytes_out;
+
+    SlimProcessor() : bytes_in(0), bytes_out(0) {}
+
+    virtual void process(const Event& event) {
+        Event slim(event);
+        projection->apply(slim);
+        bytes_in += event.ByteSize();
+        bytes_out += slim.ByteSize();
+        write(slim);
+    }
+
+    virtual ~SlimProcessor() {
+        if (bytes_in)
+            std::cout << "Slimmed " << bytes_in << " to " << bytes_out << " bytes ("
+                      << 100. * bytes_out / bytes_in << "%)" << std::endl;
+    }
+};
+
+class SlimConfiguration : public ConfigurationOf<SlimProcessor> {
+public:
+    shared<const Projection> projection;
+
+    virtual void add_options(po::options_description_easy_init opt) {
+    }
+
+    virtual void read_arguments(po::variables_map& arguments) {
+        projection.reset(new Projection(Event::descriptor(), ana::SlimEvent::descriptor()));
+    }
+
+    virtual void setup_processor(SlimProcessor& g) {
+        g.projection = projection;
+    }
+};
+
+int main(int argc, const char** argv) {
+    return a4_main_configuration<SlimConfiguration>(argc, argv);
+}
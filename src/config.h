@@ -7,10 +7,10 @@ using a4::atlas::GRL;
 using a4::atlas::FileGRL;
 using a4::atlas::NoGRL;
 
-#include <TH1D.h>
-
 #include "event_list.h"
 #include "external.h"
+#include "read_ahead.h"
+#include "correction_cache.h"
 
 
 namespace ana {
@@ -22,18 +22,25 @@ public:
     
     shared<GRL> _grl;
     shared<EventList> _ee_events;
+    shared<ReadAhead> _read_ahead;
+    shared<CorrectionCache> _correction_cache;
     
-    std::string _pileup_mc_file, _pileup_data_file, _ee_event_file;
+    std::string _pileup_mc_file, _pileup_data_file, _pileup_cache_file, _ee_event_file,
+                _correction_cache_file;
     bool _do_pileup_reweighting,
          _do_plot,
          _do_sf_reweighting,
          _require_mc_match,
          _write_anatree,
-         _filter_reco_photons;
+         _filter_reco_photons,
+         _weight_systematics,
+         _check_mass,
+         _do_showershapes,
+         _sparse_histograms,
+         _stream_samples;
          
     double _target_lumi;
-         
-    TH1D _smdiph_reweight;
+    size_t _read_ahead_files, _read_ahead_mb;
 
     virtual void add_options(po::options_description_easy_init opt) {
         opt("grl", po::value(&_grl_name), "GRL file");
@@ -41,6 +48,7 @@ public:
         opt("target-lumi,L", po::value(&_target_lumi)->default_value(4.91), "Target luminosity for reweighting");
         opt("pileup-mc", po::value<std::string>(&_pileup_mc_file)->default_value("pileup_reweighting.root"), "File with MC distributions for Pileup reweighting");
         opt("pileup-data", po::value<std::string>(&_pileup_data_file)->default_value("pileup_data.root"), "File with data distributions for Pileup reweighting");
+        opt("pileup-cache", po::value<std::string>(&_pileup_cache_file)->default_value(""), "Snapshot of the initialized pileup tool, rebuilt when the pileup files change (empty: none)");
         opt("rw-pileup", po::bool_switch(&_do_pileup_reweighting)->default_value(false), "Reweight Pileup");
         opt("rw-scalefactor", po::bool_switch(&_do_sf_reweighting)->default_value(false), "Scale factor reweighting");
         opt("do-plot", po::bool_switch(&_do_plot)->default_value(false), "Make plots");
@@ -48,10 +56,16 @@ public:
         opt("write-anatree", po::bool_switch(&_write_anatree)->default_value(false), "Write analysis tree with corrected photons");
         opt("ee-event-file", po::value(&_ee_event_file), "Filename of list of events to exclude for ee cut");
         opt("filter-reco-ph", po::bool_switch(&_filter_reco_photons)->default_value(false), "Filter reconstructed photons");
+        opt("correction-cache", po::value(&_correction_cache_file)->default_value(""), "File keeping the corrected photons across passes, rebuilt when the corrections change (empty: none)");
+        opt("read-ahead", po::value(&_read_ahead_files)->default_value(0), "Read this many input files ahead of the event loop on a background thread (0: off)");
+        opt("read-ahead-mb", po::value(&_read_ahead_mb)->default_value(512), "Maximum MB read ahead of the event loop");
+        opt("stream-samples", po::bool_switch(&_stream_samples)->default_value(false), "Write out and release each mc_channel's results when the next one starts or its input ends (inputs must be ordered by sample)");
+        opt("sparse-hist", po::bool_switch(&_sparse_histograms)->default_value(false), "Keep large, mostly empty histograms sparse until they are written");
+        opt("showershapes", po::bool_switch(&_do_showershapes)->default_value(false), "Monitor shower shapes of tight photons");
+        opt("check-mass", po::bool_switch(&_check_mass)->default_value(false), "Cross-check every m_gg against the TLorentzVector implementation");
+        opt("weight-syst", po::bool_switch(&_weight_systematics)->default_value(false), "Fill weight-only systematics (kfac_*) in a single pass under syst/");
     }
     
-    Configuration();
-
     virtual void read_arguments(po::variables_map& arguments) {
         if (arguments.count("grl")) 
             _grl.reset(new FileGRL(arguments["grl"].as<std::string>()));
@@ -60,6 +74,18 @@ public:
             
         if (_ee_event_file != "")
             _ee_events.reset(new EventList(_ee_event_file));
+        
+        if (_correction_cache_file != "") {
+            // Same constants as the processors' rescalers, see setup_processor
+            EnergyRescaler rescaler;
+            rescaler.useDefaultCalibConstants("2011");
+            _correction_cache.reset(new CorrectionCache(_correction_cache_file,
+                                                        corrections_config_hash(rescaler)));
+        }
+        
+        if (_read_ahead_files > 0 && arguments.count("input"))
+            _read_ahead.reset(new ReadAhead(arguments["input"].as<std::vector<std::string>>(),
+                                            _read_ahead_files, uint64_t(_read_ahead_mb) << 20));
     }
 
     void setup_processor(a4::process::Processor&);
@@ -0,0 +1,222 @@
+#include "correction_cache.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "external.h"
+
+namespace ana {
+
+/// Bump whenever Photon::compute_corrections changes what it computes
+static const char* const CORRECTIONS_VERSION = "compute_corrections v1";
+
+static const char MAGIC[8] = {'P', 'H', 'C', 'O', 'R', 'R', '0', '2'};
+
+struct CorrectionCacheHeader {
+    char magic[8];
+    uint64_t config, size;
+};
+
+/// FNV-1a, continuing from hash h
+static uint64_t fnv1a(const void* data, const size_t size, uint64_t h) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+uint64_t correction_input_hash(const ntup::Photon& ph) {
+    const double values[] = {
+        ph.pt(), ph.etas2(), ph.cl_e(), ph.cl_eta(), ph.cl_phi(), ph.phi(), double(ph.isconv()),
+        ph.etcone40(), ph.etcone40_ed_corrected(), ph.etap(),
+        ph.ethad(), ph.ethad1(), ph.rhad(), ph.rhad1(), ph.e277(), ph.reta(), ph.rphi(),
+        ph.weta2(), ph.f1(), ph.fside(), ph.wstot(), ph.ws3(), ph.deltae(), ph.eratio(),
+        double(ph.loose()), double(ph.tight()), double(ph.isem()),
+    };
+    return fnv1a(values, sizeof(values), 14695981039346656037ull);
+}
+
+uint64_t corrections_config_hash(const EnergyRescaler& rescaler) {
+    uint64_t h = fnv1a(CORRECTIONS_VERSION, strlen(CORRECTIONS_VERSION), 14695981039346656037ull);
+    for (unsigned int i = 0; i < rescaler.nCorrections(); i++) {
+        const auto& c = rescaler.correction(i);
+        const double values[] = {c.eta, c.phi, c.etaBinSize, c.phiBinSize, c.alpha, c.alphaErr};
+        h = fnv1a(values, sizeof(values), h);
+    }
+    return h;
+}
+
+/// Map the records of the cache file at `path`, if it is valid and was made
+/// with `config`
+static bool map_records(const std::string& path, const uint64_t config, const bool verbose,
+                        void*& map, size_t& map_size, const CorrectionRecord*& records, size_t& size) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    CorrectionCacheHeader header;
+    if (fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(header) ||
+        pread(fd, &header, sizeof(header), 0) != sizeof(header) ||
+        memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        size_t(st.st_size) != sizeof(header) + header.size * sizeof(CorrectionRecord)) {
+        if (verbose)
+            std::cerr << "Ignoring invalid correction cache " << path << std::endl;
+        close(fd);
+        return false;
+    }
+    if (header.config != config) {
+        if (verbose)
+            std::cerr << "Correction cache " << path << " was made with another configuration, rebuilding it" << std::endl;
+        close(fd);
+        return false;
+    }
+
+    void* m = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (m == MAP_FAILED) {
+        if (verbose)
+            std::cerr << "Could not map correction cache " << path << std::endl;
+        return false;
+    }
+    const CorrectionRecord* r = reinterpret_cast<const CorrectionRecord*>(static_cast<const char*>(m) + sizeof(header));
+
+    // find() binary searches, so the order must hold
+    for (size_t i = 1; i < header.size; i++) {
+        if (!(r[i-1] < r[i])) {
+            if (verbose)
+                std::cerr << "Ignoring unsorted correction cache " << path << std::endl;
+            munmap(m, st.st_size);
+            return false;
+        }
+    }
+
+    map = m;
+    map_size = st.st_size;
+    records = r;
+    size = header.size;
+    return true;
+}
+
+CorrectionCache::CorrectionCache(const std::string& path, const uint64_t config)
+    : _path(path), _config(config), _map(NULL), _map_size(0), _records(NULL), _size(0)
+{
+    map_records(path, config, true, _map, _map_size, _records, _size);
+}
+
+CorrectionCache::~CorrectionCache() {
+    if (!_new.empty())
+        merge(_new);
+    if (_map)
+        munmap(_map, _map_size);
+}
+
+/// Merge `records` into the file as it is on disk now, which other jobs may
+/// have rewritten since it was mapped
+void CorrectionCache::merge(std::vector<CorrectionRecord>& records) {
+    // Keeping the first of several records computed for the same photon
+    std::stable_sort(records.begin(), records.end());
+    records.erase(std::unique(records.begin(), records.end(),
+                              [](const CorrectionRecord& a, const CorrectionRecord& b) {
+                                  return !(a < b) && !(b < a);
+                              }), records.end());
+
+    const std::string lock_path = _path + ".lock";
+    const int lock = open(lock_path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (lock < 0 || flock(lock, LOCK_EX) != 0) {
+        std::cerr << "Could not lock correction cache " << _path << std::endl;
+        if (lock >= 0)
+            close(lock);
+        return;
+    }
+
+    void* map = NULL;
+    size_t map_size = 0, size = 0;
+    const CorrectionRecord* old = NULL;
+    map_records(_path, _config, false, map, map_size, old, size);
+
+    CorrectionCacheHeader header;
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.config = _config;
+    header.size = 0;
+
+    // Written aside and renamed, so a reader never sees half a file
+    std::string tmp = _path + ".XXXXXX";
+    const int fd = mkstemp(&tmp[0]);
+    FILE* out = fd < 0 ? NULL : fdopen(fd, "wb");
+    if (fd >= 0 && !out)
+        close(fd);
+    bool ok = out && fchmod(fd, 0644) == 0 && fwrite(&header, sizeof(header), 1, out) == 1;
+
+    // Both are sorted; the new record wins for a photon computed again (its
+    // input changed)
+    const CorrectionRecord *o = old, *const o_end = old + size;
+    auto n = records.begin();
+    while (ok && (o != o_end || n != records.end())) {
+        const CorrectionRecord* r;
+        if (n == records.end() || (o != o_end && *o < *n)) {
+            r = o++;
+        } else {
+            if (o != o_end && !(*n < *o))
+                o++;
+            r = &*n++;
+        }
+        ok = fwrite(r, sizeof(*r), 1, out) == 1;
+        header.size++;
+    }
+    ok = ok && fseek(out, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, out) == 1;
+    if (out)
+        ok = fclose(out) == 0 && ok;
+
+    if (ok && rename(tmp.c_str(), _path.c_str()) == 0) {
+        std::cout << "Correction cache " << _path << ": " << header.size << " photons ("
+                  << records.size() << " new)" << std::endl;
+    } else {
+        std::cerr << "Could not write correction cache " << _path << std::endl;
+        if (fd >= 0)
+            remove(tmp.c_str());
+    }
+
+    if (map)
+        munmap(map, map_size);
+    close(lock);
+}
+
+const CorrectionRecord* CorrectionCache::find(const uint32_t mc_channel,
+                                              const uint32_t run, const uint32_t event,
+                                              const uint32_t original_index) const {
+    CorrectionRecord key;
+    key.mc_channel = mc_channel;
+    key.runevent = uint64_t(run) << 32 | event;
+    key.original_index = original_index;
+    const CorrectionRecord* i = std::lower_bound(_records, _records + _size, key);
+    if (i == _records + _size || key < *i)
+        return NULL;
+    return i;
+}
+
+void CorrectionCache::add(const CorrectionRecord& record) {
+    std::vector<CorrectionRecord> full;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _new.push_back(record);
+        if (_new.size() < FLUSH_RECORDS)
+            return;
+        full.swap(_new);
+    }
+    // Outside the lock, so that the other processors carry on meanwhile
+    merge(full);
+}
+
+}
@@ -0,0 +1,88 @@
+#ifndef _CORRECTION_CACHE_H_
+#define _CORRECTION_CACHE_H_
+
+#include <string>
+#include <vector>
+#include <mutex>
+
+#include <a4/types.h>
+#include <a4/atlas/ntup/photon/Event.pb.h>
+
+class EnergyRescaler;
+
+namespace ana {
+
+namespace ntup = a4::atlas::ntup::photon;
+
+/// Output of Photon::compute_corrections for one photon, as stored on disk
+struct CorrectionRecord {
+    uint64_t runevent;       // run << 32 | event
+    uint32_t mc_channel;     // mc_channel_number, 0 for data
+    uint32_t original_index;
+    uint64_t input;          // hash of the input quantities, to catch changed inputs
+    double energy[5];        // Photon::EnergyVariation
+    double isolation;        // nominal
+    // After fudging (MC only)
+    double rhad, rhad1, reta, rphi, weta2, f1, fside, wstot, ws3, deltae, eratio;
+    uint32_t isem;
+    uint8_t loose, tight, pad[2];
+
+    bool operator<(const CorrectionRecord& o) const {
+        if (mc_channel != o.mc_channel) return mc_channel < o.mc_channel;
+        if (runevent != o.runevent) return runevent < o.runevent;
+        return original_index < o.original_index;
+    }
+};
+
+/// Corrected photons kept across analysis passes (--correction-cache).
+///
+/// The corrections only depend on the input photon, the event number (the
+/// smearing seed) and the configuration of the tools, so later passes can
+/// look them up instead of recomputing them. Run and event numbers repeat
+/// across MC samples, so the key includes the mc_channel_number. The file is
+/// a header followed by the records sorted by (mc_channel, run, event,
+/// original_index), mapped read-only and
+/// binary searched. Records computed during the job are merged into the file
+/// every FLUSH_RECORDS records and when the last user releases the cache. A
+/// file made with another configuration hash is ignored and replaced.
+///
+/// Several jobs may share the file: a merge takes an flock on <file>.lock,
+/// merges with what is on disk at that moment into its own temporary file and
+/// renames that into place, so no job drops the records of another.
+class CorrectionCache {
+    static const size_t FLUSH_RECORDS = 1 << 18;
+
+    std::string _path;
+    uint64_t _config;
+
+    void* _map;
+    size_t _map_size;
+    const CorrectionRecord* _records;
+    size_t _size;
+
+    std::mutex _mutex;
+    std::vector<CorrectionRecord> _new;
+
+    void merge(std::vector<CorrectionRecord>& records);
+
+public:
+    CorrectionCache(const std::string& path, uint64_t config);
+    ~CorrectionCache();
+
+    const CorrectionRecord* find(uint32_t mc_channel, uint32_t run, uint32_t event,
+                                 uint32_t original_index) const;
+    void add(const CorrectionRecord& record);
+
+    size_t size() const { return _size; }
+};
+
+/// Hash of the input photon quantities the corrections depend on
+uint64_t correction_input_hash(const ntup::Photon& ph);
+
+/// Hash of everything the corrections depend on besides the photon: the
+/// energy scale constants and the version of Photon::compute_corrections
+uint64_t corrections_config_hash(const EnergyRescaler& rescaler);
+
+}
+
+#endif
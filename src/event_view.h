@@ -2,12 +2,16 @@
 #define EVENT_VIEW_H
 
 #include <vector>
+#include <cstring>
+#include <algorithm>
 
 #include <a4/types.h>
 #include <a4/atlas/ntup/photon/Event.pb.h>
 
 #include <a4/alorentzvector.h>
 
+#include "correction_cache.h"
+
 namespace ntup = a4::atlas::ntup::photon;
 
 template <class TransientClass, class PersistentClass>
@@ -40,16 +44,33 @@ public:
 //class Event;
 
 class Photon : public PersistentWrapper<Photon, ntup::Photon> {
+public:
+    /// Energy scale and resolution variations of the corrected photon
+    enum EnergyVariation {
+        NOMINAL, SCALE_DOWN, SCALE_UP, RES_DOWN, RES_UP, N_ENERGY_VARIATIONS
+    };
+    
 private:
     shared<ntup::Photon> _corrected;
     mutable shared<ALorentzVector> _lv;
     
+    // Cached by compute_corrections so that use_energy_variation() needn't
+    // rerun the rescaler, fudging or ID
+    double _energy[N_ENERGY_VARIATIONS];
+    double _isolation[N_ENERGY_VARIATIONS];
+    unsigned int _have_isolation;
+    double _nominal_rhad, _nominal_rhad1;
+    bool _is_mc;
+    EnergyVariation _variation;
+    
 public:
     Photon() { init(); }
     explicit Photon(ntup::Photon const& ph) : PersistentWrapper<Photon, ntup::Photon>(ph) { init(); }
     explicit Photon(ntup::Photon const* ph) : PersistentWrapper<Photon, ntup::Photon>(ph) { init(); }
     
     void init() {
+        _have_isolation = 0;
+        _variation = NOMINAL;
     }
     
     /// Corrections applied
@@ -59,44 +80,10 @@ public:
     void compute_corrections(const ntup::Event& event, 
         const int original_index, EnergyRescaler& rescaler) {
         
-        auto& orig_ph = *_object;
         compute_extra_quantities(*const_cast<ntup::Photon*>(_object));
-        
-        _corrected.reset(new ntup::Photon());
+        start_corrections();
         auto& ph = *_corrected;
         
-        #define COPY(what) ph.set_##what(orig_ph.what())
-        COPY(pt);
-        COPY(etas2);
-        COPY(cl_e);
-        COPY(cl_eta);
-        COPY(cl_phi);
-        COPY(phi);
-        COPY(isconv);
-        COPY(etcone40);
-        COPY(etcone40_ed_corrected);
-        COPY(etap);
-        
-        COPY(ethad);
-        COPY(ethad1);
-        COPY(rhad);
-        COPY(rhad1);
-        COPY(e277);
-        COPY(reta);
-        COPY(rphi);
-        COPY(weta2);
-        COPY(f1);
-        COPY(fside);
-        COPY(wstot);
-        COPY(ws3);
-        COPY(deltae);
-        COPY(eratio);
-        
-        COPY(loose);
-        COPY(tight);
-        COPY(isem);
-        #undef COPY
-        
         auto is_mc = event.issimulation();
         
         double factor = 1;
@@ -104,21 +91,41 @@ public:
         
         if (is_mc) {
             const bool not_mc11c = false;
+            double factors[3];
             rescaler.SetRandomSeed(1771561 + event.event_number() + (original_index * 10));
-            factor = rescaler.getSmearingCorrectionMeV(
-                ph.cl_eta(), ph.cl_e(), 0, not_mc11c, "2011");
+            rescaler.getSmearingCorrectionsMeV(
+                ph.cl_eta(), ph.cl_e(), factors, not_mc11c);
+            factor = factors[EnergyRescaler::NOMINAL];
             
             //DEBUG("  Smearing factor: ", factor);
             
             new_e = ph.cl_e() * factor;
             //DEBUG("  new energy: ", new_e);
+            
+            _energy[RES_DOWN] = ph.cl_e() * factors[EnergyRescaler::ERR_DOWN];
+            _energy[RES_UP]   = ph.cl_e() * factors[EnergyRescaler::ERR_UP];
+            
+            // The scale uncertainty is applied on top of the smeared energy
+            double er_up = 0, er_do = 0;
+            rescaler.getErrorMeV(ph.cl_eta(), new_e / cosh(ph.cl_eta()),
+                                 er_up, er_do, "PHOTON");
+            _energy[SCALE_DOWN] = new_e / (1 + er_up);
+            _energy[SCALE_UP]   = new_e / (1 + er_do);
         } else {
-            new_e = rescaler.applyEnergyCorrectionMeV(
+            double corrected_e[3];
+            rescaler.applyEnergyCorrectionsMeV(
                 ph.cl_eta(), ph.cl_phi(), ph.cl_e(), 
                 ph.cl_e() / cosh(ph.cl_eta()),
-                0, "PHOTON");
+                corrected_e, "PHOTON");
+            new_e = corrected_e[EnergyRescaler::NOMINAL];
             factor = new_e / ph.cl_e();
+            
+            _energy[SCALE_DOWN] = corrected_e[EnergyRescaler::ERR_DOWN];
+            _energy[SCALE_UP]   = corrected_e[EnergyRescaler::ERR_UP];
+            _energy[RES_DOWN] = _energy[RES_UP] = new_e;
         }
+        _energy[NOMINAL] = new_e;
+        _is_mc = is_mc;
                 
         // Update corrected photon after fudging
         ph.set_original_index(original_index);
@@ -191,25 +198,169 @@ public:
             ph.set_tight(selection.PhotonCutsTight(6));
         }
         
-        // Isolation
-                            
-                //new_e,
-        double isolation = CaloIsoCorrection::GetPtEDCorrectedIsolation(
+        finish_corrections(corrected_isolation(new_e));
+    }
+    
+    /// The corrected photon starts as a copy of the inputs to the corrections
+    void start_corrections() {
+        auto& orig_ph = *_object;
+        _corrected.reset(new ntup::Photon());
+        auto& ph = *_corrected;
+        
+        #define COPY(what) ph.set_##what(orig_ph.what())
+        COPY(pt);
+        COPY(etas2);
+        COPY(cl_e);
+        COPY(cl_eta);
+        COPY(cl_phi);
+        COPY(phi);
+        COPY(isconv);
+        COPY(etcone40);
+        COPY(etcone40_ed_corrected);
+        COPY(etap);
+        
+        COPY(ethad);
+        COPY(ethad1);
+        COPY(rhad);
+        COPY(rhad1);
+        COPY(e277);
+        COPY(reta);
+        COPY(rphi);
+        COPY(weta2);
+        COPY(f1);
+        COPY(fside);
+        COPY(wstot);
+        COPY(ws3);
+        COPY(deltae);
+        COPY(eratio);
+        
+        COPY(loose);
+        COPY(tight);
+        COPY(isem);
+        #undef COPY
+    }
+    
+    void finish_corrections(const double isolation) {
+        auto& ph = *_corrected;
+        ph.set_analysis_isolation(isolation);
+        
+        _nominal_rhad = ph.rhad();
+        _nominal_rhad1 = ph.rhad1();
+        _isolation[NOMINAL] = isolation;
+        _have_isolation = 1 << NOMINAL;
+        _variation = NOMINAL;
+    }
+    
+    /// What compute_corrections computed, for the CorrectionCache. Only valid
+    /// right after it, before any use_energy_variation().
+    ana::CorrectionRecord correction_record(const ntup::Event& event) const {
+        auto& ph = corrected();
+        ana::CorrectionRecord r;
+        memset(&r, 0, sizeof(r));
+        r.runevent = uint64_t(event.run_number()) << 32 | event.event_number();
+        r.mc_channel = event.mc_channel_number();
+        r.original_index = ph.original_index();
+        r.input = ana::correction_input_hash(**this);
+        std::copy(_energy, _energy + N_ENERGY_VARIATIONS, r.energy);
+        r.isolation = _isolation[NOMINAL];
+        r.rhad = _nominal_rhad;
+        r.rhad1 = _nominal_rhad1;
+        r.reta = ph.reta();
+        r.rphi = ph.rphi();
+        r.weta2 = ph.weta2();
+        r.f1 = ph.f1();
+        r.fside = ph.fside();
+        r.wstot = ph.wstot();
+        r.ws3 = ph.ws3();
+        r.deltae = ph.deltae();
+        r.eratio = ph.eratio();
+        r.isem = ph.isem();
+        r.loose = ph.loose();
+        r.tight = ph.tight();
+        return r;
+    }
+    
+    /// Same result as compute_corrections, from a record it made earlier
+    void restore_corrections(const ntup::Event& event, const int original_index,
+                             const ana::CorrectionRecord& r) {
+        compute_extra_quantities(*const_cast<ntup::Photon*>(_object));
+        start_corrections();
+        auto& ph = *_corrected;
+        
+        std::copy(r.energy, r.energy + N_ENERGY_VARIATIONS, _energy);
+        _is_mc = event.issimulation();
+        
+        ph.set_original_index(original_index);
+        
+        const double new_e = _energy[NOMINAL];
+        const double new_et = new_e / cosh(ph.etas2());
+        
+        ph.set_rhad(ph.ethad() / new_et);
+        ph.set_rhad1(ph.ethad1() / new_et);
+        
+        ph.set_e(new_e);
+        ph.set_pt(new_et);
+        
+        if (_is_mc) {
+            ph.set_rhad(r.rhad);
+            ph.set_rhad1(r.rhad1);
+            ph.set_reta(r.reta);
+            ph.set_rphi(r.rphi);
+            ph.set_weta2(r.weta2);
+            ph.set_f1(r.f1);
+            ph.set_fside(r.fside);
+            ph.set_wstot(r.wstot);
+            ph.set_ws3(r.ws3);
+            ph.set_deltae(r.deltae);
+            ph.set_eratio(r.eratio);
+            ph.set_isem(r.isem);
+            ph.set_loose(r.loose);
+            ph.set_tight(r.tight);
+        }
+        
+        finish_corrections(r.isolation);
+    }
+    
+    /// Isolation of the corrected photon, given its corrected energy
+    double corrected_isolation(const double energy) const {
+        auto& ph = corrected();
+        return CaloIsoCorrection::GetPtEDCorrectedIsolation(
             ph.etcone40(),
             ph.etcone40_ed_corrected(),
             //orig_ph.cl_e(),
-            new_e,
+            energy,
             ph.etas2(),
             ph.etap(),
             ph.cl_eta(),
             40,
-            is_mc, 
+            _is_mc, 
             ph.etcone40(), 
             ph.isconv(),
             CaloIsoCorrection::PHOTON);
-            
-        ph.set_analysis_isolation(isolation);
+    }
+    
+    /// Switch the corrected photon to an energy variation. Only the energy
+    /// dependent quantities are recomputed: e, pt, rhad, rhad1 and isolation.
+    /// Shower shape fudging and the ID decisions are kept from nominal.
+    void use_energy_variation(const EnergyVariation v) {
+        if (v == _variation)
+            return;
+        
+        auto& ph = *_corrected;
+        const double e = _energy[v];
+        
+        ph.set_e(e);
+        ph.set_pt(e / cosh(ph.etas2()));
+        ph.set_rhad(_nominal_rhad * _energy[NOMINAL] / e);
+        ph.set_rhad1(_nominal_rhad1 * _energy[NOMINAL] / e);
+        
+        if (!(_have_isolation & (1 << v))) {
+            _isolation[v] = corrected_isolation(e);
+            _have_isolation |= 1 << v;
+        }
+        ph.set_analysis_isolation(_isolation[v]);
         
+        _variation = v;
     }
     
     // i is the i'th systematic variation in the relaxed_isem.
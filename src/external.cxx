@@ -1,3 +1,6 @@
+#include <fstream>
+#include <stdint.h>
+
 #include <TLorentzVector.h>
 #include "external.h"
 
@@ -6,7 +9,32 @@ TLorentzVector TLV(ALorentzVector alv) {
     return TLorentzVector(alv.px, alv.py, alv.pz, alv.E);
 }*/
 
-Root::TPileupReweighting* get_prw(const char* mc_file, const char* data_file) {
+/// FNV-1a over the contents of a file, continuing from hash h
+static uint64_t hash_file(const char* path, uint64_t h) {
+    std::ifstream in(path, std::ios::binary);
+    char buf[1 << 16];
+    while (in.read(buf, sizeof(buf)) || in.gcount()) {
+        for (std::streamsize i = 0; i < in.gcount(); i++) {
+            h ^= uint8_t(buf[i]);
+            h *= 1099511628211ull;
+        }
+    }
+    return h;
+}
+
+Root::TPileupReweighting* get_prw(const char* mc_file, const char* data_file, const char* cache_file) {
+    // Initialize() reads both ROOT files and builds the normalised
+    // distributions. The result only depends on the input files' contents
+    // and the fixed settings below, so it can be reloaded from a snapshot.
+    const bool use_cache = cache_file && *cache_file;
+    const uint64_t key = use_cache ? hash_file(data_file, hash_file(mc_file, 14695981039346656037ull)) : 0;
+    if (use_cache) {
+        auto* cached = new Root::TPileupReweighting("pileup_reweighting");
+        if (cached->ReadSnapshot(cache_file, key) == 0)
+            return cached;
+        delete cached;
+    }
+    
     auto* pileup_tool = new Root::TPileupReweighting("pileup_reweighting");
     
     pileup_tool->AddConfigFile(mc_file);
@@ -17,6 +45,9 @@ Root::TPileupReweighting* get_prw(const char* mc_file, const char* data_file) {
     pileup_tool->SetUnrepresentedDataAction(2);
     //pileup_tool->SetDefaultChannel(default_channel);
     pileup_tool->Initialize();
+    
+    if (use_cache)
+        pileup_tool->WriteSnapshot(cache_file, key);
     return pileup_tool;
 }
 
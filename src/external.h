@@ -14,7 +14,9 @@ using eg2011::EnergyRescaler;
 #include <TLorentzVector.h>
 
 //TLorentzVector TLV(ALorentzVector alv);
-Root::TPileupReweighting* get_prw(const char* mc_file, const char* data_file);
+// With a cache_file, the initialized tool is snapshotted there and reused
+// for as long as the contents of mc_file and data_file stay the same
+Root::TPileupReweighting* get_prw(const char* mc_file, const char* data_file, const char* cache_file=NULL);
 double ReturnRZ_1stSampling_cscopt2(double eta_1st_sampling);
 double GetCorrectedInvMass(double Elead, double etaS1lead, double philead,
     double Esublead, double etaS1sublead, double phisublead, double PV_ID);
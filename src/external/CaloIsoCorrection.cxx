@@ -43,6 +43,22 @@ namespace CaloIsoCorrection{
   const float eta_bins_fine[nBinsEtaFine+1] = {0.0, 0.10, 0.60, 0.80, 1.15, 1.37, 1.52, 1.81, 2.01, 2.37, 2.47};
   const float eta_bins_coarse[nBinsEtaCoarse+1] = {0.0, 0.60, 1.37, 1.52, 1.81, 2.47};
 
+  // pT leakage correction parameters of one (radius, parttype, conversion,
+  // version, data/mc) combination, resolved per fine eta bin: the mc slopes
+  // plus the data slopes of the enclosing coarse bin, and the mc offsets.
+  // Bin nBinsEtaFine is outside the binning, where nothing is corrected.
+  struct PtCorrectionTable {
+    float slope[nBinsEtaFine+1];
+    float offset[nBinsEtaFine+1];
+  };
+
+  bool GetPtCorrectionPointers(int newrad, bool is_mc, bool isConversion, ParticleType parttype, Version ver,
+                               const float*& mc_correction_slopes_ptr,
+                               const float*& mc_correction_offsets_ptr,
+                               const float*& data_correction_slopes_ptr);
+  const PtCorrectionTable* GetPtCorrectionTable(int newrad, bool is_mc, bool isConversion, ParticleType parttype, Version ver);
+  unsigned int GetEtaBinFineIndexed(float eta);
+
 // ----------------------------------------------------------------------------
 // ------------- 2010 leakage corrections -------------------------------------
   // OLD isolation corrections: fine grained in eta, derived from MC08
@@ -355,6 +371,48 @@ float CaloIsoCorrection::GetPtEDCorrectedIsolation(float Etcone40,
 }
 //-----------------------------------------------------------------------
 
+//-----------------------------------------------------------------------
+// User function
+// Batched pt leakage + energy density corrected isolation
+//
+void CaloIsoCorrection::GetPtEDCorrectedIsolation(unsigned int n,
+                                                  const float* Etcone40,
+                                                  const float* Etcone40_ED_corrected,
+                                                  const float* energy, 
+                                                  const float* etaS2, 
+                                                  const float* etaPointing, 
+                                                  const float* etaCluster, 
+                                                  float radius, 
+                                                  bool is_mc, 
+                                                  const float* Etcone_value,
+                                                  const bool* isConversion,
+                                                  float* corrected,
+                                                  ParticleType parttype,
+                                                  Version ver){
+
+  int newrad = GetRadius(radius);
+  const PtCorrectionTable* tables[2] = {
+    GetPtCorrectionTable(newrad, is_mc, false, parttype, ver),
+    GetPtCorrectionTable(newrad, is_mc, true, parttype, ver)
+  };
+
+  for (unsigned int i = 0; i < n; ++i) {
+    const PtCorrectionTable* table = tables[isConversion[i]];
+    if (!table) {
+      // unknown radius: the single photon version complains about it
+      corrected[i] = GetPtEDCorrectedIsolation(Etcone40[i], Etcone40_ED_corrected[i], energy[i], etaS2[i],
+                                               etaPointing[i], etaCluster[i], radius, is_mc, Etcone_value[i],
+                                               isConversion[i], parttype, ver);
+      continue;
+    }
+    unsigned int eta_bin = GetEtaBinFineIndexed(etaS2[i]);
+    float pt_correction = table->offset[eta_bin] + GetPtCorrectionValue(energy[i], etaPointing[i], etaCluster[i], table->slope[eta_bin]);
+    float ED_correction = GetEDCorrection(Etcone40[i], Etcone40_ED_corrected[i], radius);
+    corrected[i] = Etcone_value[i] - pt_correction - ED_correction;
+  }
+}
+//-----------------------------------------------------------------------
+
 //-----------------------------------------------------------------------
 // User function
 // Returns the error on the nPV pileup correction
@@ -407,9 +465,30 @@ float CaloIsoCorrection::GetPtCorrection(float energy,
                                              bool isConversion, ParticleType parttype, Version ver){
                                              
   int newrad = GetRadius(radius);
-  const float* mc_correction_slopes_ptr(0);
-  const float* mc_correction_offsets_ptr(0);
-  const float* data_correction_slopes_ptr(0);
+  const PtCorrectionTable* table = GetPtCorrectionTable(newrad, is_mc, isConversion, parttype, ver);
+  if (!table) {
+    std::cerr << "Unable to retrieve leakage correction for cone with radius = " << radius << "." << std::endl
+              << "--- Radii must be one of {.15, .20, .25, .30, .35, .40} OR {15, 20, 25, 30, 35, 40}." << std::endl;
+    return 0.;
+  }
+
+  unsigned int eta_bin = GetEtaBinFineIndexed(etaS2);
+  return table->offset[eta_bin] + GetPtCorrectionValue(energy, etaPointing, etaCluster, table->slope[eta_bin]);
+
+}
+//-----------------------------------------------------------------------
+
+//-----------------------------------------------------------------------
+// Internal function
+// Picks the pt leakage correction arrays. Returns false for unknown radii.
+//
+bool CaloIsoCorrection::GetPtCorrectionPointers(int newrad, bool is_mc, bool isConversion, ParticleType parttype, Version ver,
+                                                const float*& mc_correction_slopes_ptr,
+                                                const float*& mc_correction_offsets_ptr,
+                                                const float*& data_correction_slopes_ptr){
+  mc_correction_slopes_ptr = 0;
+  mc_correction_offsets_ptr = 0;
+  data_correction_slopes_ptr = 0;
   switch(newrad){
     case 15: 
       if (parttype == PHOTON) {
@@ -625,17 +704,51 @@ float CaloIsoCorrection::GetPtCorrection(float energy,
       }
       break;
     default:
-      std::cerr << "Unable to retrieve leakage correction for cone with radius = " << radius << "." << std::endl
-                << "--- Radii must be one of {.15, .20, .25, .30, .35, .40} OR {15, 20, 25, 30, 35, 40}." << std::endl;
-      return 0.;
+      return false;
   }
+  return true;
 
-  float scale_factor = GetPtCorrectionFactor(etaS2, mc_correction_slopes_ptr, data_correction_slopes_ptr);
-  float offset = 0.;
-  if (mc_correction_offsets_ptr) offset = GetPtCorrectionFactor(etaS2, mc_correction_offsets_ptr);
-  
-  return offset + GetPtCorrectionValue(energy, etaPointing, etaCluster, scale_factor);
+}
+//-----------------------------------------------------------------------
 
+//-----------------------------------------------------------------------
+// Internal function
+// The pt leakage correction tables, resolved once for every combination.
+// Returns 0 for unknown radii.
+//
+namespace {
+  struct PtCorrectionTables {
+    // [radius 15..40][is_mc][isConversion][parttype == PHOTON][ver == REL17]
+    CaloIsoCorrection::PtCorrectionTable table[6][2][2][2][2];
+    bool valid;
+
+    PtCorrectionTables() : valid(true) {
+      using namespace CaloIsoCorrection;
+      for (int r = 0; r < 6; ++r)
+      for (int m = 0; m < 2; ++m)
+      for (int c = 0; c < 2; ++c)
+      for (int p = 0; p < 2; ++p)
+      for (int v = 0; v < 2; ++v) {
+        PtCorrectionTable& t = table[r][m][c][p][v];
+        const float *mc_slopes, *mc_offsets, *data_slopes;
+        valid &= GetPtCorrectionPointers(15 + 5*r, m, c, p ? PHOTON : ELECTRON, v ? REL17 : REL16,
+                                         mc_slopes, mc_offsets, data_slopes);
+        // the lower edge of each fine bin is also in the matching coarse bin
+        for (unsigned int i = 0; i < nBinsEtaFine; ++i) {
+          t.slope[i] = GetPtCorrectionFactor(eta_bins_fine[i], mc_slopes, data_slopes);
+          t.offset[i] = mc_offsets ? GetPtCorrectionFactor(eta_bins_fine[i], mc_offsets) : 0.;
+        }
+        t.slope[nBinsEtaFine] = 0.;
+        t.offset[nBinsEtaFine] = 0.;
+      }
+    }
+  };
+}
+
+const CaloIsoCorrection::PtCorrectionTable* CaloIsoCorrection::GetPtCorrectionTable(int newrad, bool is_mc, bool isConversion, ParticleType parttype, Version ver){
+  static const PtCorrectionTables tables;
+  if (newrad < 15 || newrad > 40 || newrad % 5 != 0 || !tables.valid) return 0;
+  return &tables.table[(newrad - 15)/5][is_mc][isConversion][parttype == PHOTON][ver == REL17];
 }
 //-----------------------------------------------------------------------
 
@@ -829,6 +942,41 @@ int CaloIsoCorrection::GetEtaBinCoarse(float eta){
 //-----------------------------------------------------------------------
 
 
+//-----------------------------------------------------------------------
+// Internal function
+// Same bins as GetEtaBinFine, but found by indexing a table in steps of
+// 0.01 in |eta| and fixing up at the (at most one) edge in that step.
+// Returns nBinsEtaFine, instead of -1, outside the binning.
+//
+namespace {
+  struct EtaBinFineLookup {
+    static const int nSteps = 248;
+    unsigned int bin[nSteps];
+
+    EtaBinFineLookup() {
+      using namespace CaloIsoCorrection;
+      for (int k = 0; k < nSteps; ++k) {
+        int b = GetEtaBinFine(k/100.);
+        bin[k] = (b < 0) ? nBinsEtaFine-1 : b;
+      }
+    }
+  };
+}
+
+unsigned int CaloIsoCorrection::GetEtaBinFineIndexed(float eta){
+  static const EtaBinFineLookup lookup;
+  float fabs_eta = fabs(eta);
+  if (!(fabs_eta < eta_bins_fine[nBinsEtaFine])) return nBinsEtaFine;
+
+  int k = int(fabs_eta * 100);
+  unsigned int eta_bin = lookup.bin[k < EtaBinFineLookup::nSteps ? k : EtaBinFineLookup::nSteps-1];
+  while (fabs_eta < eta_bins_fine[eta_bin]) --eta_bin;
+  while (fabs_eta >= eta_bins_fine[eta_bin+1]) ++eta_bin;
+  return eta_bin;
+}
+//-----------------------------------------------------------------------
+
+
 //-----------------------------------------------------------------------
 // Internal function
 // Returns the appropriate corrections value
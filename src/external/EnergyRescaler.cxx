@@ -25,6 +25,7 @@ namespace eg2011 {
 
 ///default constructor
 EnergyRescaler::EnergyRescaler()
+   : m_corrTable(0), m_corrSize(0)
 {
 
    //default seed
@@ -50,11 +51,13 @@ bool EnergyRescaler::readCalibConstants(std::string fname)
 { 
 
    
-   if( m_corrVec.size()) {
-      std::cout<<" WARNING having already  "<<m_corrVec.size()<<"  corrections "<<std::endl;
+   if( nCorrections()) {
+      std::cout<<" WARNING having already  "<<nCorrections()<<"  corrections "<<std::endl;
       m_corrVec.clear();
 
    }
+   m_corrTable = 0;
+   m_corrSize = 0;
 
    
    std::ifstream infile; 
@@ -106,17 +109,17 @@ double EnergyRescaler::applyEnergyCorrectionGeV(double eta, double phi, double e
 
    double corrEnergy=-999.0;
    
-   if(m_corrVec.size()==0)
+   if(nCorrections()==0)
    {
       std::cout<<"NO CORRECTIONS EXISTS, PLEASE EITHER SUPPLY A CORRECTION FILE OR USE THE DEFAULT CORRECTIONS"<<std::endl;
    }
 
-   for (unsigned int i=0; i< m_corrVec.size(); i++)
+   for (unsigned int i=0; i< nCorrections(); i++)
    {
 
       if( 
-         eta>=( m_corrVec.at(i).eta - m_corrVec.at(i).etaBinSize/2.) && eta< ( m_corrVec.at(i).eta+m_corrVec.at(i).etaBinSize/2.)  &&
-         phi>=( m_corrVec.at(i).phi - m_corrVec.at(i).phiBinSize/2.) && phi< ( m_corrVec.at(i).phi+m_corrVec.at(i).phiBinSize/2.) 
+         eta>=( correction(i).eta - correction(i).etaBinSize/2.) && eta< ( correction(i).eta+correction(i).etaBinSize/2.)  &&
+         phi>=( correction(i).phi - correction(i).phiBinSize/2.) && phi< ( correction(i).phi+correction(i).phiBinSize/2.) 
          ) 
       { 
 
@@ -134,24 +137,24 @@ double EnergyRescaler::applyEnergyCorrectionGeV(double eta, double phi, double e
          {
             default:
             {
-               scale=m_corrVec.at(i).alpha;
+               scale=correction(i).alpha;
                break;
             }
             case NOMINAL:
             {
-               scale=m_corrVec.at(i).alpha;
+               scale=correction(i).alpha;
                break;
             }
             case ERR_UP:
             {
-               scale=m_corrVec.at(i).alpha;
+               scale=correction(i).alpha;
                getErrorGeV(eta,et, er_up, er_do, ptype);
                scale+=er_do;
                break;
             }
             case ERR_DOWN:
             {
-               scale=m_corrVec.at(i).alpha;
+               scale=correction(i).alpha;
                getErrorGeV(eta,et, er_up, er_do, ptype);
                scale+=er_up;
                break;
@@ -162,7 +165,7 @@ double EnergyRescaler::applyEnergyCorrectionGeV(double eta, double phi, double e
 
          corrEnergy =  energy/(1.+ scale);
 
-         // std::cout<<" eta : "<<eta <<" uncorrected energy : "<<    energy <<" corr energy : "<< corrEnergy<<" scale : "<< m_corrVec.at(i).alpha <<endl;
+         // std::cout<<" eta : "<<eta <<" uncorrected energy : "<<    energy <<" corr energy : "<< corrEnergy<<" scale : "<< correction(i).alpha <<endl;
          break;
       }
    }
@@ -174,11 +177,45 @@ double EnergyRescaler::applyEnergyCorrectionGeV(double eta, double phi, double e
 
 
 
+void EnergyRescaler::applyEnergyCorrectionsGeV(double eta, double phi, double energy, double et, double corr_energy[3], std::string ptype) const
+{ 
+
+   corr_energy[NOMINAL] = corr_energy[ERR_DOWN] = corr_energy[ERR_UP] = energy;
+   
+   if(nCorrections()==0)
+   {
+      std::cout<<"NO CORRECTIONS EXISTS, PLEASE EITHER SUPPLY A CORRECTION FILE OR USE THE DEFAULT CORRECTIONS"<<std::endl;
+   }
+
+   for (unsigned int i=0; i< nCorrections(); i++)
+   {
+      const calibMap& map = correction(i);
+
+      if( 
+         eta>=( map.eta - map.etaBinSize/2.) && eta< ( map.eta+map.etaBinSize/2.)  &&
+         phi>=( map.phi - map.phiBinSize/2.) && phi< ( map.phi+map.phiBinSize/2.) 
+         ) 
+      { 
+
+         for(std::string::iterator p = ptype.begin(); ptype.end() != p; ++p)
+         *p = toupper(*p);
+
+         double er_up=-99,er_do=0; 
+         getErrorGeV(eta,et, er_up, er_do, ptype);
+
+         corr_energy[NOMINAL]  = energy/(1.+ map.alpha);
+         corr_energy[ERR_DOWN] = energy/(1.+ map.alpha + er_up);
+         corr_energy[ERR_UP]   = energy/(1.+ map.alpha + er_do);
+         break;
+      }
+   }
+
+} 
+
+
+
 void EnergyRescaler::getErrorGeV(double cl_eta,double cl_et, double &er_up, double &er_do, std::string ptype,bool withXMAT,bool withPS) const
 {
-  // Quick and dirty
-  // Need to optimized
-
   er_up=-1;
   er_do=-1;
 
@@ -212,6 +249,27 @@ void EnergyRescaler::getErrorGeV(double cl_eta,double cl_et, double &er_up, doub
   static double pho_XMAT_MAX[nbins]={  0.003,  0.005,  0.010,  777,   0.010,   0.01  ,0, 0.} ;
  static double pho_PS_shift[nbins] ={  0.001,  0.002,  0.003,  777,   0.002*2,   0.000  ,0, 0.} ;
 
+  // The et-independent systematics only depend on the bin, so their sums
+  // in quadrature are computed once rather than on every call
+  struct QuadratureSums { double up[nbins], down[nbins]; };
+  static const QuadratureSums sys2 = []() {
+    QuadratureSums q;
+    for(int i=0;i<nbins;i++)
+      {
+        q.down[i] = stat[i]*stat[i]+
+                    sys_mcclosure[i]*sys_mcclosure[i]+
+                    sys_comparison[i]*sys_comparison[i]+
+                    sys_pileup[i]*sys_pileup[i]+
+                    sys_loose2tight_forward[i]*sys_loose2tight_forward[i]+
+                    sys_masscut[i]*sys_masscut[i]+
+                    sys_HV[i]*sys_HV[i]+
+                    sys_elecLin[i]*sys_elecLin[i]+
+                    sys_xtalkE1[i]*sys_xtalkE1[i];
+        q.up[i] = q.down[i] + sys_medium2tight_up[i]*sys_medium2tight_up[i];
+      }
+    return q;
+  }();
+
   int bin =-1;
   for(int i=0;i<nbins;i++)
     {
@@ -311,29 +369,12 @@ void EnergyRescaler::getErrorGeV(double cl_eta,double cl_et, double &er_up, doub
       lowpt =sys_lowpt[bin]/(10-20)*(cl_et-20);
     }
 
-  er_up= sqrt(stat[bin]*stat[bin]+
- 	      sys_mcclosure[bin]*sys_mcclosure[bin]+
- 	      sys_comparison[bin]*sys_comparison[bin]+
- 	      sys_pileup[bin]*sys_pileup[bin]+
-  	      sys_medium2tight_up[bin]*sys_medium2tight_up[bin]+
-	      sys_loose2tight_forward[bin]*sys_loose2tight_forward[bin]+
-  	      sys_masscut[bin]*sys_masscut[bin]+
-  	      sys_HV[bin]*sys_HV[bin]+
-  	      sys_elecLin[bin]*sys_elecLin[bin]+
-	      sys_xtalkE1[bin]*sys_xtalkE1[bin]+
+  er_up= sqrt(sys2.up[bin]+
  	      PS_up*PS_up+
  	      XMat_up*XMat_up+
 	      lowpt*lowpt);
   
-  er_do= -sqrt(stat[bin]*stat[bin]+
-	      sys_mcclosure[bin]*sys_mcclosure[bin]+
-	      sys_comparison[bin]*sys_comparison[bin]+
-	      sys_pileup[bin]*sys_pileup[bin]+
-	      sys_loose2tight_forward[bin]*sys_loose2tight_forward[bin]+
-	      sys_masscut[bin]*sys_masscut[bin]+
-  	      sys_HV[bin]*sys_HV[bin]+
-	      sys_elecLin[bin]*sys_elecLin[bin]+
-	      sys_xtalkE1[bin]*sys_xtalkE1[bin]+
+  er_do= -sqrt(sys2.down[bin]+
 	      PS_do*PS_do+
 	      XMat_do*XMat_do+
 	      lowpt*lowpt);
@@ -348,315 +389,128 @@ void EnergyRescaler::getErrorGeV(double cl_eta,double cl_et, double &er_up, doub
 
 
 /////default constants, for 60 eta bins
-bool  EnergyRescaler::useDefaultCalibConstants( std::string corr_version)
-{
-   
-   //if(corr_version!="2010")return true;
-
-   const int netaBins=58;
-   const int nphiBins=58;
-   
-   ///for 2011
-   const int netaBinsFor2011=32;
-   const int nphiBinsFor2011=32;
-   
-  
-   double m_2pi = 2.*acos(-1.); 
-   //cout<<" pi : "<<acos(-1.)<<"  M_PI : "<<M_PI<<" 2pi : "<<m_2pi<<endl;
-   
-
-  
-
-   if( m_corrVec.size()) {
-      std::cout<<" WARNING having already  "<<m_corrVec.size()<<"  corrections "<<std::endl;
-      m_corrVec.clear();
-
-   }
-   
-
-   
-
-  
-   double eta_tmp[netaBins]={   
-      -4.45, -3.60, -3.00, -2.65, -2.435, -2.35, -2.25, -2.15, -2.05, -1.95, -1.85,	-1.75,	-1.65,
-      -1.56, -1.445,	-1.335,	-1.25, -1.15,	-1.05,	-0.95,	-0.85,	-0.75,	-0.65,	-0.55,	-0.45,	-0.35,
-      -0.25, -0.15,	-0.05,	0.05,  0.15,	0.25,	0.35,	0.45,	0.55,	0.65,	0.75,	0.85,	0.95,
-       1.05, 1.15,	1.25,	1.335, 1.445,	1.56,	1.65,	1.75,	1.85,	1.95,	2.05,	2.15,	2.25,
-       2.35,	2.435,   2.65,	3.00,	3.60,	4.45
-         };
-   
-
-   
-
-
-    double etaBinWidth_tmp[netaBins]= {
-       0.9, 0.8, 0.4, 0.3, 0.07,	0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.08,	0.15,	0.07,	0.1,	0.1,	0.1,	        0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	        0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.1,	0.07,	0.15,	0.08,	0.1,	0.1,	0.1,	0.1,	        0.1,	0.1,	0.1,	0.1,	0.07,    0.3,	0.4,	0.8,	0.9 };
-
-   
-    
-
-   
-    double phi_tmp[nphiBins]={
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,0, 0, 0, 0, 0, 	0, 0, 0, 0, 0, 0, 0, 0,	0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,0, 0, 0, 0, 0, 0, 0, 0, 0,	0, 0 };
-
-    double phiBinWidth_tmp[nphiBins]={
-       m_2pi, m_2pi, m_2pi, m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,
-       m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi, m_2pi,m_2pi,m_2pi,m_2pi,
-       m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi, m_2pi,
-       m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,
-       m_2pi,m_2pi, m_2pi,m_2pi,m_2pi,m_2pi,m_2pi, m_2pi, m_2pi, m_2pi, m_2pi, m_2pi };
-
-
-    
-    
-
-   double alpha_tmp[netaBins]= {
-    0.046962, 0.044332,	-0.007777,-0.045341, -0.053683,-0.005040,0.003357,0.003830,0.016857,0.012810,
-    0.008882,-0.016864,-0.021280,-0.011215,-0.008958,-0.010248, 0.005199,0.007815,-0.000701,0.003837,0.003222,
-    -0.004017,-0.005908,-0.009560,-0.005382,-0.012158,-0.005060,-0.008274, -0.006701,-0.002734,-0.012920, 
-    -0.010972,-0.006823,-0.007234,-0.002612,-0.004301,0.001580,-0.001986,-0.001306,0.005748, 0.002906, 
-    0.001381,-0.001584,0.000799,-0.002511,-0.030902,-0.016416,-0.004976,0.002408,0.018706,-0.004309,-0.002673,
-    -0.001735,-0.050173, -0.034703,	-0.003296,	0.047351,	0.028374
+namespace {
+
+   constexpr double twoPi = 2.*3.14159265358979323846;
+
+   // { eta, phi, etaBinSize, phiBinSize, alpha, alphaErr }
+   constexpr EnergyRescaler::calibMap defaultCalib2010[] = {
+      {  -4.45, 0,  0.9, twoPi,  0.046962, 0.019646 },
+      {  -3.60, 0,  0.8, twoPi,  0.044332, 0.011500 },
+      {  -3.00, 0,  0.4, twoPi, -0.007777, 0.008761 },
+      {  -2.65, 0,  0.3, twoPi, -0.045341, 0.009514 },
+      { -2.435, 0, 0.07, twoPi, -0.053683, 0.008341 },
+      {  -2.35, 0,  0.1, twoPi, -0.005040, 0.006345 },
+      {  -2.25, 0,  0.1, twoPi,  0.003357, 0.005522 },
+      {  -2.15, 0,  0.1, twoPi,  0.003830, 0.005089 },
+      {  -2.05, 0,  0.1, twoPi,  0.016857, 0.005387 },
+      {  -1.95, 0,  0.1, twoPi,  0.012810, 0.005861 },
+      {  -1.85, 0,  0.1, twoPi,  0.008882, 0.005821 },
+      {  -1.75, 0,  0.1, twoPi, -0.016864, 0.005119 },
+      {  -1.65, 0,  0.1, twoPi, -0.021280, 0.006227 },
+      {  -1.56, 0, 0.08, twoPi, -0.011215, 0.009148 },
+      { -1.445, 0, 0.15, twoPi, -0.008958, 0.003920 },
+      { -1.335, 0, 0.07, twoPi, -0.010248, 0.004309 },
+      {  -1.25, 0,  0.1, twoPi,  0.005199, 0.002929 },
+      {  -1.15, 0,  0.1, twoPi,  0.007815, 0.003882 },
+      {  -1.05, 0,  0.1, twoPi, -0.000701, 0.004054 },
+      {  -0.95, 0,  0.1, twoPi,  0.003837, 0.003716 },
+      {  -0.85, 0,  0.1, twoPi,  0.003222, 0.003673 },
+      {  -0.75, 0,  0.1, twoPi, -0.004017, 0.003832 },
+      {  -0.65, 0,  0.1, twoPi, -0.005908, 0.003275 },
+      {  -0.55, 0,  0.1, twoPi, -0.009560, 0.002075 },
+      {  -0.45, 0,  0.1, twoPi, -0.005382, 0.004004 },
+      {  -0.35, 0,  0.1, twoPi, -0.012158, 0.002497 },
+      {  -0.25, 0,  0.1, twoPi, -0.005060, 0.003182 },
+      {  -0.15, 0,  0.1, twoPi, -0.008274, 0.002512 },
+      {  -0.05, 0,  0.1, twoPi, -0.006701, 0.003974 },
+      {   0.05, 0,  0.1, twoPi, -0.002734, 0.002302 },
+      {   0.15, 0,  0.1, twoPi, -0.012920, 0.003670 },
+      {   0.25, 0,  0.1, twoPi, -0.010972, 0.003322 },
+      {   0.35, 0,  0.1, twoPi, -0.006823, 0.003978 },
+      {   0.45, 0,  0.1, twoPi, -0.007234, 0.002164 },
+      {   0.55, 0,  0.1, twoPi, -0.002612, 0.001984 },
+      {   0.65, 0,  0.1, twoPi, -0.004301, 0.002093 },
+      {   0.75, 0,  0.1, twoPi,  0.001580, 0.002372 },
+      {   0.85, 0,  0.1, twoPi, -0.001986, 0.003843 },
+      {   0.95, 0,  0.1, twoPi, -0.001306, 0.004138 },
+      {   1.05, 0,  0.1, twoPi,  0.005748, 0.004277 },
+      {   1.15, 0,  0.1, twoPi,  0.002906, 0.003003 },
+      {   1.25, 0,  0.1, twoPi,  0.001381, 0.004690 },
+      {  1.335, 0, 0.07, twoPi, -0.001584, 0.005480 },
+      {  1.445, 0, 0.15, twoPi,  0.000799, 0.006306 },
+      {   1.56, 0, 0.08, twoPi, -0.002511, 0.007338 },
+      {   1.65, 0,  0.1, twoPi, -0.030902, 0.005939 },
+      {   1.75, 0,  0.1, twoPi, -0.016416, 0.004472 },
+      {   1.85, 0,  0.1, twoPi, -0.004976, 0.004535 },
+      {   1.95, 0,  0.1, twoPi,  0.002408, 0.005453 },
+      {   2.05, 0,  0.1, twoPi,  0.018706, 0.008538 },
+      {   2.15, 0,  0.1, twoPi, -0.004309, 0.004554 },
+      {   2.25, 0,  0.1, twoPi, -0.002673, 0.003382 },
+      {   2.35, 0,  0.1, twoPi, -0.001735, 0.005504 },
+      {  2.435, 0, 0.07, twoPi, -0.050173, 0.007577 },
+      {   2.65, 0,  0.3, twoPi, -0.034703, 0.010095 },
+      {   3.00, 0,  0.4, twoPi, -0.003296, 0.009122 },
+      {   3.60, 0,  0.8, twoPi,  0.047351, 0.013400 },
+      {   4.45, 0,  0.9, twoPi,  0.028374, 0.02588 }
    };
 
-   
-
-   
-
-   double alphaError_tmp[netaBins]={ 
-      0.019646, 0.011500, 0.008761, 0.009514, 0.008341,0.006345,0.005522,0.005089,0.005387,0.005861,
-      0.005821,0.005119,0.006227,0.009148,0.003920,0.004309,0.002929,  0.003882,0.004054,0.003716,0.003673,
-      0.003832,0.003275,0.002075,0.004004,0.002497,0.003182,0.002512,0.003974,0.002302, 0.003670,0.003322,
-      0.003978,0.002164,0.001984,0.002093,0.002372,0.003843,0.004138,0.004277,0.003003,0.004690,0.005480,
-      0.006306,	0.007338,0.005939,0.004472,0.004535,0.005453,0.008538,0.004554,0.003382,0.005504,0.007577,
-      0.010095,	0.009122,	0.013400,	0.02588
-   };
-
-
    //////NUMBERS for 2011 data
-   double etaFor2011_tmp[netaBinsFor2011]={ 
-      -4.05,	-3.00,	-2.65,	-2.385,	-2.2,	-2.00,	-1.8,	-1.61,	-1.445,	-1.285,	-1.1,	-0.9,	-0.7,	-0.5,	-0.3,	-0.1,	0.1,	0.3,	0.5,	0.7,	0.9,	1.1,	1.285,	1.445,	1.61,	1.8,	2.0,	2.2,	2.385,	2.65,	3.0,	4.05
+   // current central and forward scales are wrt mc11c,
+   // commented numbers are wrt mc11a
+   constexpr EnergyRescaler::calibMap defaultCalib2011[] = {
+      {  -4.05, 0,  1.7, twoPi,   0.02250430, 0.002444877 },
+      {  -3.00, 0,  0.4, twoPi,  -0.00374902, 0.004809635 },
+      {  -2.65, 0,  0.3, twoPi,   0.02535370, 0.003156490 },
+      { -2.385, 0, 0.17, twoPi,    0.0037675, 0.000470342 },   // 0.00464523,
+      {   -2.2, 0,  0.2, twoPi,   0.00490447, 0.000374852 },   // 0.0057822,
+      {  -2.00, 0,  0.2, twoPi,     0.005687, 0.000359052 },   // 0.00656473,
+      {   -1.8, 0,  0.2, twoPi,   0.00802105, 0.000374378 },   // 0.00889878,
+      {  -1.61, 0, 0.18, twoPi,  -0.00528993, 0.00048418 },   // -0.0044122,
+      { -1.445, 0, 0.15, twoPi,   -0.0116496, 0.000597172 },   // -0.0107719,
+      { -1.285, 0, 0.17, twoPi,   0.00592598, 0.000350214 },   // 0.00680371,
+      {   -1.1, 0,  0.2, twoPi,   0.00247059, 0.000294693 },   // 0.00334832,
+      {   -0.9, 0,  0.2, twoPi, -0.000855526, 0.000276543 },   // 2.22039e-05,
+      {   -0.7, 0,  0.2, twoPi,   0.00509505, 0.000253397 },   // 0.00597278,
+      {   -0.5, 0,  0.2, twoPi,   0.00583526, 0.000242044 },   // 0.00671299,
+      {   -0.3, 0,  0.2, twoPi,  -0.00340543, 0.000241598 },   // -0.0025277,
+      {   -0.1, 0,  0.2, twoPi,  -0.00348403, 0.00025457 },   // -0.0026063,
+      {    0.1, 0,  0.2, twoPi,  -0.00196953, 0.000242443 },   // -0.0010918,
+      {    0.3, 0,  0.2, twoPi,  -0.00182113, 0.00024981 },   // -0.0009434,
+      {    0.5, 0,  0.2, twoPi,   0.00389051, 0.000243194 },   // 0.00476824,
+      {    0.7, 0,  0.2, twoPi,   0.00538199, 0.000263781 },   // 0.00625972,
+      {    0.9, 0,  0.2, twoPi,   0.00098167, 0.000281633 },   // 0.0018594,
+      {    1.1, 0,  0.2, twoPi,   0.00467596, 0.000302674 },   // 0.00555369,
+      {  1.285, 0, 0.17, twoPi,   0.00733492, 0.000370169 },   // 0.00821265,
+      {  1.445, 0, 0.15, twoPi,  -0.00631553, 0.000620942 },   // -0.0054378,
+      {   1.61, 0, 0.18, twoPi,   -0.0114566, 0.000500065 },   // -0.0105789,
+      {    1.8, 0,  0.2, twoPi,   -4.104e-05, 0.000378803 },   // 0.00083669,
+      {    2.0, 0,  0.2, twoPi,  -0.00356843, 0.000365644 },   // -0.0026907,
+      {    2.2, 0,  0.2, twoPi,  -0.00392083, 0.0003695 },   // -0.0030431,
+      {  2.385, 0, 0.17, twoPi,  -0.00479783, 0.000474544 },   // -0.0039201,
+      {   2.65, 0,  0.3, twoPi,   0.00541310, 0.006143817 },
+      {    3.0, 0,  0.4, twoPi,  -0.00480631, 0.005388449 },
+      {   4.05, 0,  1.7, twoPi,   0.01122000, 0.003915748 }
    };
 
-    double etaBinWidthFor2011_tmp[netaBinsFor2011]= {
-       1.7,	0.4,	0.3,  0.17,	0.2,	0.2,	0.2,	0.18,	0.15,	0.17,	0.2,	0.2,	0.2,	0.2,	0.2,	0.2,	0.2,	0.2,	0.2,	0.2,	0.2,	0.2,	0.17,	0.15,	0.18,	0.2,	0.2,	0.2,	0.17,   0.3,	0.4,	1.7
-    };
-
-    double phiFor2011_tmp[nphiBinsFor2011]={
-       0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-        };
-
-    double phiBinWidthFor2011_tmp[nphiBinsFor2011]={
-       m_2pi, m_2pi, m_2pi, m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,
-       m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi, m_2pi, m_2pi, m_2pi, m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,
-       m_2pi,m_2pi,m_2pi,m_2pi,m_2pi,m_2pi
-       };
-
-
-    
-//     double alphaFor2011_tmp[netaBinsFor2011]= {
-//        0.01767670,
-//        0.01193680,
-//        0.02863680,
-//        -0.00182836,
-//        0.00379822,
-//        0.00949851,
-//        0.00388223,
-//        -0.00630638,
-//        -0.01459190,
-//        0.00191748,
-//        0.00120518,
-//        -0.00116847,
-//        0.00316491,
-//        0.00534383,
-//        -0.00259050,
-//        -0.00303995,
-//        -0.00114055,
-//        -0.00152093,
-//        0.00346042,
-//        0.00316020,
-//        -6.51986e-05,
-//        0.00237845,
-//        0.00391017,
-//        -0.01056940,
-//        -0.01190480,
-//        -0.00177316,
-//        -0.00101658,
-//        -0.00430559,
-//        -0.01101630,
-//        0.01681920,
-//        0.01459770,
-//        0.00328200
-       
-//     };
-   
-
-    double alphaFor2011_Prel_Jan2012[netaBinsFor2011]= {
-
-      // current central and forward scales are wrt mc11c
-      // commented numbers are wrt mc11a
-
-       0.02250430,
-       -0.00374902,
-       0.02535370,
-       0.0037675,         //   0.00464523,   
-       0.00490447,        //   0.0057822,    
-       0.005687,          //   0.00656473,   
-       0.00802105,        //   0.00889878,   
-       -0.00528993,       //  -0.0044122,  
-       -0.0116496,        //  -0.0107719,   
-       0.00592598,        //   0.00680371,   
-       0.00247059,        //   0.00334832,   
-       -0.000855526,      //   2.22039e-05,  
-       0.00509505,        //   0.00597278,   
-       0.00583526,        //   0.00671299,   
-       -0.00340543,       //  -0.0025277,  
-       -0.00348403,       //  -0.0026063,  
-       -0.00196953,       //  -0.0010918,  
-       -0.00182113,       //  -0.0009434, 
-       0.00389051,        //   0.00476824,   
-       0.00538199,        //   0.00625972,    
-       0.00098167,        //   0.0018594,   
-       0.00467596,        //   0.00555369,   
-       0.00733492,        //   0.00821265,    
-       -0.00631553,       //  -0.0054378,    
-       -0.0114566,        //  -0.0105789,    
-       -4.104e-05,        //   0.00083669,  
-       -0.00356843,       //  -0.0026907,  
-       -0.00392083,       //  -0.0030431,  
-       -0.00479783,       //  -0.0039201,  
-       0.00541310,
-       -0.00480631,
-       0.01122000
-       
-    };
-   
-
-//     double alphaErrorFor2011_tmp[netaBinsFor2011]={ 
-//       0.00365611,
-//       0.00269144,
-//       0.00253709,
-//       0.00124745,
-//       0.00094802,
-//       0.00094137,
-//       0.00097271,
-//       0.00130736,
-//       0.00170269,
-//       0.00091738,
-//       0.00076709,
-//       0.00072777,
-//       0.00067059,
-//       0.00063910,
-//       0.00064532,
-//       0.00063576,
-//       0.00066304,
-//       0.00064027,
-//       0.00066183,
-//       0.00068352,
-//       0.00075179,
-//       0.00080414,
-//       0.00093506,
-//       0.00167934,
-//       0.00131510,
-//       0.00097932,
-//       0.00095425,
-//       0.00097240,
-//       0.00127444,
-//       0.00258217,
-//       0.00265290,
-//       0.00360700
-
-//    };
-
-    double alphaErrorFor2011_Prel_Jan2012[netaBinsFor2011]={ 
-      0.002444877,
-      0.004809635,
-      0.003156490,
-      0.000470342,        
-      0.000374852,       
-      0.000359052,          
-      0.000374378,         
-      0.00048418,          
-      0.000597172,           
-      0.000350214,         
-      0.000294693,         
-      0.000276543,        
-      0.000253397,        
-      0.000242044,         
-      0.000241598,         
-      0.00025457,           
-      0.000242443,           
-      0.00024981,           
-      0.000243194,           
-      0.000263781,        
-      0.000281633,         
-      0.000302674,          
-      0.000370169,         
-      0.000620942,         
-      0.000500065,          
-      0.000378803,          
-      0.000365644,          
-      0.0003695,            
-      0.000474544,            
-      0.006143817,
-      0.005388449,
-      0.003915748
-
-   };
-
-
-
-
-    calibMap myMap;
-    
-    if(corr_version!="2010"){
-       
-       for(int i=0; i<netaBinsFor2011; i++){
-
-          //for(int j=0; j<nphiBins; j++){///this should be a 2d array finally
-          //}
-
-          myMap.eta= etaFor2011_tmp[i];
-          myMap.etaBinSize =etaBinWidthFor2011_tmp[i];
-
-	  //          myMap.alpha = alphaFor2011_tmp[i];
-          myMap.alpha = alphaFor2011_Prel_Jan2012[i];
-
-          myMap.phi = phiFor2011_tmp[i];
-          myMap.phiBinSize = phiBinWidthFor2011_tmp[i];
-
-	  //          myMap.alphaErr = alphaErrorFor2011_tmp[i];
-          myMap.alphaErr = alphaErrorFor2011_Prel_Jan2012[i];
-
-          m_corrVec.push_back(myMap);
-
-       }
-        
-
-    }else{
-
-       
-       for(int i=0; i<netaBins; i++){
-
-          //for(int j=0; j<nphiBins; j++){///this should be a 2d array finally
-          //}
-
-          myMap.eta= eta_tmp[i];
-          myMap.etaBinSize =etaBinWidth_tmp[i];
-          myMap.alpha = alpha_tmp[i];
-          myMap.phi = phi_tmp[i];
-          myMap.phiBinSize = phiBinWidth_tmp[i];
-          myMap.alphaErr = alphaError_tmp[i];
-
-          m_corrVec.push_back(myMap);
-
-       }
-
+}
 
-    }//if-else
+bool  EnergyRescaler::useDefaultCalibConstants( std::string corr_version)
+{
 
+   if( nCorrections()) {
+      std::cout<<" WARNING having already  "<<nCorrections()<<"  corrections "<<std::endl;
+   }
+   m_corrVec.clear();
+
+   // The tables are only referenced, nothing is copied
+   if(corr_version!="2010"){
+      m_corrTable = defaultCalib2011;
+      m_corrSize = sizeof(defaultCalib2011)/sizeof(*defaultCalib2011);
+   }else{
+      m_corrTable = defaultCalib2010;
+      m_corrSize = sizeof(defaultCalib2010)/sizeof(*defaultCalib2010);
+   }
 
    return true;
 }
@@ -666,14 +520,14 @@ bool  EnergyRescaler::useDefaultCalibConstants( std::string corr_version)
 bool EnergyRescaler::printMap() const
 {
 
-   for (unsigned int i=0; i< m_corrVec.size(); i++)
+   for (unsigned int i=0; i< nCorrections(); i++)
    {
-      std::cout<<"eta :  "<< m_corrVec.at(i).eta <<
-         " etaErr : " <<m_corrVec.at(i).etaBinSize<<
-         " phi    :  "<<m_corrVec.at(i).phi<<
-         " phiErr :  "<<m_corrVec.at(i).phiBinSize<<
-         " alpha  :  "<<m_corrVec.at(i).alpha<<
-         " alphaErr : "<<m_corrVec.at(i).alphaErr<<endl;
+      std::cout<<"eta :  "<< correction(i).eta <<
+         " etaErr : " <<correction(i).etaBinSize<<
+         " phi    :  "<<correction(i).phi<<
+         " phiErr :  "<<correction(i).phiBinSize<<
+         " alpha  :  "<<correction(i).alpha<<
+         " alphaErr : "<<correction(i).alphaErr<<endl;
    }
 
 
@@ -1049,6 +903,49 @@ double EnergyRescaler::getSmearingCorrectionGeV(double eta, double energy, int v
 }
 
 
+void EnergyRescaler::getSmearingCorrectionsGeV(double eta, double energy, double factors[3], bool mc_withCT) 
+{
+  double resMC, resData, errUp, errDown;
+  resMC   = resolution( energy, eta, false );
+  resData = resolution( energy, eta, true );
+  resolutionError( energy, eta, errUp, errDown );
+
+  double Cmc = 0.007;
+
+  double resVar[3];
+  resVar[NOMINAL]  = resData;
+  resVar[ERR_DOWN] = resData + errDown;
+  resVar[ERR_UP]   = resData + errUp;
+
+  //=====================================
+  //Smearing procedure, sharing one draw:
+  //Gaus(0, sigma) == sigma * Gaus(0, 1)
+  //=====================================
+
+  double z = 0;
+  bool drawn = false;
+
+  for (int i = 0; i < 3; i++) {
+    double sigma2 = std::pow( resVar[i]*energy, 2 ) - std::pow( resMC*energy, 2 );
+    if (mc_withCT==true) 
+      sigma2 = sigma2 - std::pow( Cmc*energy, 2 );
+
+    if (sigma2<=0) {
+      factors[i] = 1;
+      continue;
+    }
+
+    if (!drawn) {
+      z = m_random3.Gaus(0,1);
+      drawn = true;
+    }
+
+    double DeltaE0 = sqrt(sigma2) * z;
+    factors[i] = (energy+DeltaE0)/energy;
+  }
+}
+
+
 // a calibration correction for crack electrons, to be applied to both data and MC
 
 double EnergyRescaler::applyMCCalibrationGeV(double eta, double ET, std::string ptype) {
@@ -200,6 +200,9 @@ namespace Root {
       //-----------------------------------------------------
       Int_t Fill(const TString weightName,Int_t runNumber,Int_t channelNumber,Float_t w,Float_t x, Float_t y=0., Float_t z=0.);
       Int_t Fill(Int_t runNumber,Int_t channelNumber,Float_t w,Float_t x, Float_t y=0., Float_t z=0.);
+      /** The histogram Fill would fill for [weight,run,channel], creating it if needed. 
+          Keep it to fill many events of the same run and channel without the lookups */
+      TH1* GetFillHistogram(const TString weightName,Int_t runNumber,Int_t channelNumber);
       Int_t WriteToFile(const TString filename=""); //if no name given, will use tool name
 
 
@@ -229,6 +232,16 @@ namespace Root {
       std::map<TString, std::map<Int_t,std::map<Int_t, TH1*> > >& GetInputHistograms() { return m_inputHistograms;}
 
 
+      //-----------------------------------------------------
+      //Binary snapshot of an initialized tool, for fast startup
+      //-----------------------------------------------------
+      /** Write everything Initialize built to fileName, tagged with key (e.g. a hash of the inputs) */
+      Int_t WriteSnapshot(const TString fileName, ULong64_t key);
+      /** Use on a freshly constructed tool instead of adding inputs and calling Initialize. 
+          Returns non-zero if the file is missing or has another version or key, then discard the tool */
+      Int_t ReadSnapshot(const TString fileName, ULong64_t key);
+
+
       //-----------------------------------------------------
       //Methods to inspect the input and weighting histograms
       //-----------------------------------------------------
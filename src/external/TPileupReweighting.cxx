@@ -31,6 +31,14 @@ Description: Tool to get the calculated MC pileup weight.
 #include <TString.h>
 #include <TRandom3.h>
 
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/stat.h>
+
 
 // // // ClassImp(Root::TPileupReweighting)
 
@@ -1554,6 +1562,20 @@ Int_t Root::TPileupReweighting::Fill(Int_t runNumber,Int_t channelNumber,Float_t
 //fills the appropriate inputHistograms
 Int_t Root::TPileupReweighting::Fill(const TString weightName,Int_t runNumber,Int_t channelNumber,Float_t w,Float_t x, Float_t y, Float_t z) {
 
+   TH1* hist = GetFillHistogram(weightName,runNumber,channelNumber);
+
+   if(hist->GetDimension()==1) {
+      return hist->Fill(x,w);
+   } else if(hist->GetDimension()==2) {
+      return (dynamic_cast<TH2*>(hist))->Fill(x,y,w);
+   } else if(hist->GetDimension()==3) {
+      return (dynamic_cast<TH3*>(hist))->Fill(x,y,z,w);
+   }
+   return -1;
+}
+
+TH1* Root::TPileupReweighting::GetFillHistogram(const TString weightName,Int_t runNumber,Int_t channelNumber) {
+
    //should only be given genuine mcRunNumbers if mc (channel>=0). We don't fill periodNumber distributions 
    if(channelNumber>=0) {
       if(m_mcRemappings.find(runNumber)!=m_mcRemappings.end()) runNumber=m_mcRemappings[runNumber];
@@ -1579,14 +1601,7 @@ Int_t Root::TPileupReweighting::Fill(const TString weightName,Int_t runNumber,In
       throw std::runtime_error("Throwing 45");
    }
 
-   if(hist->GetDimension()==1) {
-      return hist->Fill(x,w);
-   } else if(hist->GetDimension()==2) {
-      return (dynamic_cast<TH2*>(hist))->Fill(x,y,w);
-   } else if(hist->GetDimension()==3) {
-      return (dynamic_cast<TH3*>(hist))->Fill(x,y,z,w);
-   }
-   return -1;
+   return hist;
 }
 
 //=============================================================================
@@ -1675,3 +1690,203 @@ Int_t Root::TPileupReweighting::Merge(TCollection *coll) {
 }
 
 
+//=============================================================================
+// Snapshots: the state after Initialize, in a versioned binary file
+//=============================================================================
+namespace {
+
+   const char snapshotMagic[8] = {'P','R','W','S','N','A','P','\0'};
+   //bump whenever the layout below or the meaning of a member changes
+   const UInt_t snapshotVersion = 1;
+
+   template <typename T>
+   typename std::enable_if<std::is_arithmetic<T>::value>::type
+   put(std::ostream& out, const T& v) { out.write(reinterpret_cast<const char*>(&v),sizeof(v)); }
+   template <typename T>
+   typename std::enable_if<std::is_arithmetic<T>::value>::type
+   get(std::istream& in, T& v) { in.read(reinterpret_cast<char*>(&v),sizeof(v)); }
+
+   void put(std::ostream& out, const TString& s) {
+      put(out,Int_t(s.Length()));
+      out.write(s.Data(),s.Length());
+   }
+   void get(std::istream& in, TString& s) {
+      Int_t n=0; get(in,n);
+      if(!in || n<0) { in.setstate(std::ios::failbit); return; }
+      std::vector<char> buf(n);
+      in.read(buf.data(),n);
+      s = TString(buf.data(),n);
+   }
+
+   template <typename A, typename B>
+   void put(std::ostream& out, const std::pair<A,B>& p) { put(out,p.first); put(out,p.second); }
+   template <typename A, typename B>
+   void get(std::istream& in, std::pair<A,B>& p) { get(in,p.first); get(in,p.second); }
+
+   void put(std::ostream& out, const std::vector<Double_t>& v) {
+      put(out,UInt_t(v.size()));
+      for(UInt_t i=0;i<v.size();i++) put(out,v[i]);
+   }
+   void get(std::istream& in, std::vector<Double_t>& v) {
+      UInt_t n=0; get(in,n);
+      v.resize(in ? n : 0);
+      for(UInt_t i=0;i<v.size();i++) get(in,v[i]);
+   }
+
+   //1D and 2D histograms, binning and contents only. Null is allowed
+   void putHist(std::ostream& out, const TH1* h) {
+      put(out,Bool_t(h!=0));
+      if(!h) return;
+      put(out,TString(h->GetName()));
+      Int_t dim = h->GetDimension();
+      put(out,dim);
+      const TAxis* axes[2] = {h->GetXaxis(),h->GetYaxis()};
+      Int_t ncells = 1;
+      for(Int_t d=0;d<dim;d++) {
+         Int_t n = axes[d]->GetNbins();
+         put(out,n);
+         for(Int_t i=1;i<=n+1;i++) put(out,axes[d]->GetBinLowEdge(i));
+         ncells *= n+2;
+      }
+      for(Int_t bin=0;bin<ncells;bin++) put(out,h->GetBinContent(bin));
+      put(out,h->GetEntries());
+   }
+   TH1* getHist(std::istream& in) {
+      Bool_t present=false; get(in,present);
+      if(!in || !present) return 0;
+      TString name; get(in,name);
+      Int_t dim=0; get(in,dim);
+      if(!in || dim<1 || dim>2) { in.setstate(std::ios::failbit); return 0; }
+      std::vector<Double_t> edges[2];
+      Int_t ncells = 1;
+      for(Int_t d=0;d<dim;d++) {
+         Int_t n=0; get(in,n);
+         if(!in || n<1) { in.setstate(std::ios::failbit); return 0; }
+         edges[d].resize(n+1);
+         for(Int_t i=0;i<=n;i++) get(in,edges[d][i]);
+         ncells *= n+2;
+      }
+      if(!in) return 0;
+      TH1* h = (dim==1) ? static_cast<TH1*>(new TH1D(name,name,edges[0].size()-1,edges[0].data()))
+                        : static_cast<TH1*>(new TH2D(name,name,edges[0].size()-1,edges[0].data(),edges[1].size()-1,edges[1].data()));
+      h->SetDirectory(0);
+      for(Int_t bin=0;bin<ncells;bin++) { Double_t v=0; get(in,v); h->SetBinContent(bin,v); }
+      Double_t entries=0; get(in,entries);
+      h->SetEntries(entries);
+      return h;
+   }
+   void put(std::ostream& out, TH1* const& h) { putHist(out,h); }
+   void put(std::ostream& out, TH1D* const& h) { putHist(out,h); }
+   void put(std::ostream& out, TH2D* const& h) { putHist(out,h); }
+   void get(std::istream& in, TH1*& h) { h = getHist(in); }
+   void get(std::istream& in, TH1D*& h) { h = dynamic_cast<TH1D*>(getHist(in)); }
+   void get(std::istream& in, TH2D*& h) { h = dynamic_cast<TH2D*>(getHist(in)); }
+
+   template <typename K, typename V>
+   void put(std::ostream& out, const std::map<K,V>& m) {
+      put(out,UInt_t(m.size()));
+      for(typename std::map<K,V>::const_iterator it=m.begin();it!=m.end();++it) {
+         put(out,it->first); put(out,it->second);
+      }
+   }
+   template <typename K, typename V>
+   void get(std::istream& in, std::map<K,V>& m) {
+      UInt_t n=0; get(in,n);
+      for(UInt_t i=0;i<n && in;i++) {
+         K key; get(in,key);
+         get(in,m[key]);
+      }
+   }
+
+}
+
+Int_t Root::TPileupReweighting::WriteSnapshot(const TString fileName, ULong64_t key) {
+   if(!m_isInitialized) {
+      Error("WriteSnapshot","Please initialize the tool before writing a snapshot");
+      return -1;
+   }
+
+   //write to a temporary file and rename, so that concurrent jobs never see a partial snapshot.
+   //mkstemp makes it unique per call, as every processor thread of a job writes its own
+   std::string tmpTemplate = std::string(fileName.Data()) + ".tmpXXXXXX";
+   int fd = mkstemp(&tmpTemplate[0]);
+   if(fd==-1) {
+      Error("WriteSnapshot","Could not create a temporary file for %s",fileName.Data());
+      return -1;
+   }
+   fchmod(fd,0644);
+   close(fd);
+   TString tmpName = tmpTemplate.c_str();
+   {
+      std::ofstream out(tmpName.Data(),std::ios::binary|std::ios::trunc);
+      out.write(snapshotMagic,sizeof(snapshotMagic));
+      put(out,snapshotVersion);
+      put(out,key);
+
+      put(out,m_countingMode); put(out,m_defaultChannel); put(out,m_unrepresentedDataAction);
+      put(out,m_lumiVectorIsLoaded);
+      put(out,m_periods); put(out,m_periodToMCRun); put(out,m_mcRemappings);
+      put(out,m_emptyHistograms);
+      put(out,globalTotals); put(out,periodTotals); put(out,globalNumberOfEntries);
+      put(out,primaryDistributions); put(out,secondaryDistributions);
+      put(out,m_metadata); put(out,dataPeriodRunTotals); put(out,m_badbins);
+      put(out,m_integratedLumiVector);
+      out.write(snapshotMagic,sizeof(snapshotMagic));
+
+      if(!out) {
+         Error("WriteSnapshot","Could not write %s",tmpName.Data());
+         std::remove(tmpName.Data());
+         return -1;
+      }
+   }
+   if(std::rename(tmpName.Data(),fileName.Data())!=0) {
+      Error("WriteSnapshot","Could not rename %s to %s",tmpName.Data(),fileName.Data());
+      std::remove(tmpName.Data());
+      return -1;
+   }
+   return 0;
+}
+
+Int_t Root::TPileupReweighting::ReadSnapshot(const TString fileName, ULong64_t key) {
+   if(m_isInitialized) {
+      Error("ReadSnapshot","You cannot ReadSnapshot after initializing the tool");
+      throw std::runtime_error("Throwing 1");
+   }
+
+   std::ifstream in(fileName.Data(),std::ios::binary);
+   if(!in) return -1;
+
+   char magic[sizeof(snapshotMagic)];
+   UInt_t version=0; ULong64_t fileKey=0;
+   in.read(magic,sizeof(magic));
+   get(in,version); get(in,fileKey);
+   if(!in || std::string(magic,sizeof(magic))!=std::string(snapshotMagic,sizeof(snapshotMagic))) {
+      Warning("ReadSnapshot","%s is not a snapshot",fileName.Data());
+      return -1;
+   }
+   if(version!=snapshotVersion || fileKey!=key) {
+      Info("ReadSnapshot","%s is out of date, ignoring it",fileName.Data());
+      return -1;
+   }
+
+   for(std::map<TString, TH1*>::iterator it=m_emptyHistograms.begin();it!=m_emptyHistograms.end();++it) delete it->second;
+   m_emptyHistograms.clear();
+
+   get(in,m_countingMode); get(in,m_defaultChannel); get(in,m_unrepresentedDataAction);
+   get(in,m_lumiVectorIsLoaded);
+   get(in,m_periods); get(in,m_periodToMCRun); get(in,m_mcRemappings);
+   get(in,m_emptyHistograms);
+   get(in,globalTotals); get(in,periodTotals); get(in,globalNumberOfEntries);
+   get(in,primaryDistributions); get(in,secondaryDistributions);
+   get(in,m_metadata); get(in,dataPeriodRunTotals); get(in,m_badbins);
+   get(in,m_integratedLumiVector);
+   in.read(magic,sizeof(magic));
+
+   if(!in || std::string(magic,sizeof(magic))!=std::string(snapshotMagic,sizeof(snapshotMagic))) {
+      Warning("ReadSnapshot","%s is truncated or corrupt",fileName.Data());
+      return -1;
+   }
+
+   m_isInitialized=true;
+   return 0;
+}
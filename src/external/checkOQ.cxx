@@ -18,12 +18,37 @@ IMPORTANT NOTE: It is recommended to use the eta and phi of the cluster!
 #include "egammaAnalysisUtils/checkOQ.h"
 
 #include <cmath>
+#include <algorithm>
 using std::abs;
 
 #include <TMath.h>
 
 //ClassImp(egammaOQ)
 
+namespace {
+  // Dead regions of S2 from firstRun on: a cluster is bad if one of its
+  // corners is inside [etaMin,etaMax] x [phiMin,phiMax]
+  struct DeadRegion { int firstRun; double etaMin, etaMax, phiMin, phiMax; };
+  const DeadRegion deadRegions[] = {
+    //4 dead Febs from run 180614:  eta-phi range: [0.0,1.45] x [-0.78847,-0.59213]
+    {180614, 0., 1.45, -0.78847, -0.59213},
+  };
+  const unsigned int nDeadRegions = sizeof(deadRegions)/sizeof(*deadRegions);
+
+  // MC runs of the four periods weighted by getOQWeight
+  const int mcRuns[4] = {180164, 183003, 185649, 185761};
+
+  // a point inside each cell of egammaOQ::gridCell
+  double cellCentre(const vector<double>& edges, int cell) {
+    int k = cell/2;
+    if (cell % 2) return edges[k];
+    if (edges.empty()) return 0.;
+    if (k == 0) return edges.front() - 1.;
+    if (k == int(edges.size())) return edges.back() + 1.;
+    return (edges[k-1] + edges[k])/2.;
+  }
+}
+
 egammaOQ::egammaOQ( string /*name*/ )
 {
   //TNamed::SetName( name.c_str() );
@@ -32,6 +57,42 @@ egammaOQ::egammaOQ( string /*name*/ )
   m_RunFracMC.push_back(0.41);
   m_RunFracMC.push_back(0.42);
   m_RunFracMC.push_back(0.10);
+
+  for (int i = 0; i < 4; i++) m_OQWeight[i] = -999.;
+
+  // one grid per run period, with all regions dead by then
+  for (unsigned int p = 0; p < nDeadRegions; p++) {
+    if (!m_deadRegions.empty() && m_deadRegions.back().firstRun == deadRegions[p].firstRun) continue;
+    DeadRegionGrid grid;
+    grid.firstRun = deadRegions[p].firstRun;
+    for (unsigned int r = 0; r < nDeadRegions; r++) {
+      if (deadRegions[r].firstRun > grid.firstRun) continue;
+      grid.etaEdges.push_back(deadRegions[r].etaMin);
+      grid.etaEdges.push_back(deadRegions[r].etaMax);
+      grid.phiEdges.push_back(deadRegions[r].phiMin);
+      grid.phiEdges.push_back(deadRegions[r].phiMax);
+    }
+    std::sort(grid.etaEdges.begin(), grid.etaEdges.end());
+    grid.etaEdges.erase(std::unique(grid.etaEdges.begin(), grid.etaEdges.end()), grid.etaEdges.end());
+    std::sort(grid.phiEdges.begin(), grid.phiEdges.end());
+    grid.phiEdges.erase(std::unique(grid.phiEdges.begin(), grid.phiEdges.end()), grid.phiEdges.end());
+
+    // every region boundary is a cell boundary, so a cell is either all dead or not
+    const int netacells = 2*grid.etaEdges.size()+1, nphicells = 2*grid.phiEdges.size()+1;
+    grid.dead.resize(netacells*nphicells);
+    for (int e = 0; e < netacells; e++) {
+      const double eta = cellCentre(grid.etaEdges, e);
+      for (int f = 0; f < nphicells; f++) {
+        const double phi = cellCentre(grid.phiEdges, f);
+        for (unsigned int r = 0; r < nDeadRegions; r++) {
+          const DeadRegion& d = deadRegions[r];
+          if (d.firstRun <= grid.firstRun && eta>=d.etaMin && eta<=d.etaMax && phi>=d.phiMin && phi<=d.phiMax)
+            grid.dead[e*nphicells + f] = true;
+        }
+      }
+    }
+    m_deadRegions.push_back(grid);
+  }
 }
 
 egammaOQ::~egammaOQ()
@@ -42,6 +103,14 @@ int egammaOQ::setLumiVec(double Per1,double Per2,double Per3,double Per4) {
   m_LumiVec.push_back(Per2);
   m_LumiVec.push_back(Per3);
   m_LumiVec.push_back(Per4);
+
+  double TotLumi = 0;
+  for(unsigned int i=0;i<m_LumiVec.size();i++){
+    TotLumi = TotLumi+m_LumiVec[i]; 
+  }
+  for(unsigned int i=0;i<4;i++){
+    m_OQWeight[i] = m_LumiVec[i]/TotLumi*(1./m_RunFracMC[i]);
+  }
   return 0;
 }
 double egammaOQ::getOQWeight(int runnumber) const {
@@ -49,19 +118,10 @@ double egammaOQ::getOQWeight(int runnumber) const {
   double OQWeight= -999.;
   if( m_LumiVec.size() != 4)
     std::cout << "Wrong lumi vector in input !" << std::endl;
-  double TotLumi = 0;
-  for(unsigned int i=0;i<m_LumiVec.size();i++){
-    TotLumi = TotLumi+m_LumiVec[i]; 
-  }
 
-  if( runnumber == 180164){
-    OQWeight = m_LumiVec[0]/TotLumi*(1./m_RunFracMC[0]);
-  }else if( runnumber==183003 ){
-    OQWeight = m_LumiVec[1]/TotLumi*(1./m_RunFracMC[1]);
-  }else if( runnumber==185649 ){
-    OQWeight= m_LumiVec[2]/TotLumi*(1./m_RunFracMC[2]); 
-  }else if( runnumber==185761 ){
-    OQWeight= m_LumiVec[3]/TotLumi*(1./m_RunFracMC[3]); 
+  const int* run = std::find(mcRuns, mcRuns+4, runnumber);
+  if( run != mcRuns+4 ){
+    OQWeight = m_OQWeight[run-mcRuns];
   }else{
     std::cout << "Unknown RunNumber" << std::endl;
   }
@@ -93,14 +153,49 @@ int egammaOQ::checkOQClusterPhoton(int runnumber, double myEta, double myPhi, bo
   return result;
 }
 
+void egammaOQ::checkOQClusterPhotons(int runnumber, unsigned int n, const double* myEta, const double* myPhi, const bool* conv, int* result, bool syst) const {
+
+  //the run period is the same for all of them
+  const DeadRegionGrid* grid = deadRegionGrid(runnumber);
+  for (unsigned int i=0; i<n; i++) {
+    if (!grid) {
+      result[i] = 1;
+      continue;
+    }
+    int netacells=0, nphicells=0;
+    result[i] = clusterSize(myEta[i], conv[i] ? 3 : 2, syst, netacells, nphicells);
+    if (result[i] == 0)
+      result[i] = deadRegionS2(*grid, myEta[i], myPhi[i], netacells*0.025/2., nphicells*0.025/2.);
+  }
+}
+
 
 int egammaOQ::checkOQCluster(int runnumber, double myEta, double myPhi, int candidate, bool syst, bool verbose) const {
 
   //check that the run is affected
-  if (runnumber<180614) {
+  const DeadRegionGrid* grid = deadRegionGrid(runnumber);
+  if (!grid) {
     return 1;
   }
 
+  int netacells=0;
+  int nphicells=0;
+  if (clusterSize(myEta, candidate, syst, netacells, nphicells) != 0)
+    return 3;
+
+  //
+  // check quality of cluster
+  //
+  if (verbose) std::cout << "CHECKING THE " << netacells << "x" << nphicells << " CLUSTER CENTERED IN ===> " << myEta << " " << myPhi << std::endl;   
+  if (verbose) std::cout << "checking the whole cluster..." << endl;
+  return deadRegionS2(*grid, myEta, myPhi, netacells*0.025/2., nphicells*0.025/2.);
+}
+
+
+//
+// helper function: cluster size in cells for the candidate type, 3 if it is unknown
+//
+int egammaOQ::clusterSize(double myEta, int candidate, bool syst, int& netacells, int& nphicells) const {
 
   //
   // check that user has selected either photon or electron as candidate type
@@ -115,8 +210,6 @@ int egammaOQ::checkOQCluster(int runnumber, double myEta, double myPhi, int cand
   //
   // define cluster size around cluster barycenter
   //
-  int netacells=0;
-  int nphicells=0;
   int addcell= 0;
   if (syst) addcell=1;
   const double etabarrel=1.37; 
@@ -150,11 +243,7 @@ int egammaOQ::checkOQCluster(int runnumber, double myEta, double myPhi, int cand
     }
   }
 
-
-  //
-  // check quality of cluster
-  //
-  return checkOQCluster(myEta, myPhi, netacells, nphicells, candidate, verbose);
+  return 0;
 }
 
 
@@ -180,11 +269,35 @@ int egammaOQ::checkOQCluster(double myEta, double myPhi, int NetaCells, int Nphi
 }
 
 
+//
+// The grid of the run period of runnumber, 0 before the first one
+const egammaOQ::DeadRegionGrid* egammaOQ::deadRegionGrid(int runnumber) const {
+  const DeadRegionGrid* grid = 0;
+  for (unsigned int i=0; i<m_deadRegions.size() && m_deadRegions[i].firstRun <= runnumber; i++)
+    grid = &m_deadRegions[i];
+  return grid;
+}
+
+//
+// Cell of x: 2k below edges[k] (and above edges[k-1]), 2k+1 at edges[k]
+int egammaOQ::gridCell(const vector<double>& edges, double x) {
+  int k = std::lower_bound(edges.begin(), edges.end(), x) - edges.begin();
+  if (k < int(edges.size()) && edges[k] == x) return 2*k+1;
+  return 2*k;
+}
+
+bool egammaOQ::isDead(const DeadRegionGrid& grid, double eta, double phi) const {
+  return grid.dead[gridCell(grid.etaEdges, eta)*(2*grid.phiEdges.size()+1) + gridCell(grid.phiEdges, phi)];
+}
 
 
 //
-// Check for dead regions in S2
+// Check for dead regions in S2, of the latest run period
 int egammaOQ::deadRegionS2(double myEta, double myPhi, double deltaEta, double deltaPhi, int /*candidate*/, bool /*verbose*/) const {
+  return deadRegionS2(m_deadRegions.back(), myEta, myPhi, deltaEta, deltaPhi);
+}
+
+int egammaOQ::deadRegionS2(const DeadRegionGrid& grid, double myEta, double myPhi, double deltaEta, double deltaPhi) const {
   
   int theValue= 0; 
   
@@ -196,17 +309,9 @@ int egammaOQ::deadRegionS2(double myEta, double myPhi, double deltaEta, double d
   if(phiLowBound<-pi) phiLowBound +=  2.*pi; //crossing the lower bound in Phi
   if(phiUpBound> pi) phiUpBound -=  2.*pi;  //crossing upper bound in Phi
   
-  //4 dead Febs from run 180614:  eta-phi range: [0.0,1.45] x [-0.78847,-0.59213]
-  //S2
-  if(etaLowBound>=0. && etaLowBound <=1.45) {
-    if( phiLowBound>=-0.78847 && phiLowBound<=-0.59213) return 3;
-    if( phiUpBound>=-0.78847 && phiUpBound<=-0.59213) return 3;
-  }
-  if(etaUpBound>=0. && etaUpBound <=1.45) {
-    if( phiLowBound>=-0.78847 && phiLowBound<=-0.59213) return 3;
-    if( phiUpBound>=-0.78847 && phiUpBound<=-0.59213) return 3;
-  }
+  //a corner of the cluster in a dead region
+  if (isDead(grid, etaLowBound, phiLowBound) || isDead(grid, etaLowBound, phiUpBound) ||
+      isDead(grid, etaUpBound, phiLowBound) || isDead(grid, etaUpBound, phiUpBound)) return 3;
   
   return(theValue);
 }
-
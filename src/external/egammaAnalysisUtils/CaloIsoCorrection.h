@@ -196,6 +196,27 @@ namespace CaloIsoCorrection{
                                   ParticleType parttype = ELECTRON,
                                   Version ver = REL17);
   
+  // -----------------------------------------------------------------
+  // -------- batched pT leakage + ED pileup corrections -------------
+  // - same as above for n particles at once, written to corrected[]
+  // - the leakage corrections are resolved into tables once, so each
+  //   particle costs an eta bin lookup and a multiply-add
+  
+  void GetPtEDCorrectedIsolation(unsigned int n,
+                                 const float* Etcone40,
+                                 const float* Etcone40_ED_corrected,
+                                 const float* energy,
+                                 const float* etaS2,
+                                 const float* etaPointing,
+                                 const float* etaCluster,
+                                 float radius,
+                                 bool is_mc,
+                                 const float* Etcone_value,
+                                 const bool* isConversion,
+                                 float* corrected,
+                                 ParticleType parttype = ELECTRON,
+                                 Version ver = REL17);
+  
   // ---------------------------------------------------------
   // ----------- errors on nPV pileup corrections ------------
   
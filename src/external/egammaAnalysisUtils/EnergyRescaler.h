@@ -52,6 +52,13 @@ class EnergyRescaler {
       double applyEnergyCorrectionMeV(double cl_eta, double cl_phi, double uncorr_energy, double et, 
 				      int value=NOMINAL /* NOMINAL=0, ERROR_DOWN==1, ERROR_UP==2*/, std::string part_type="ELECTRON" ) const;
 
+      //as above, but fills corr_energy[NOMINAL], corr_energy[ERR_DOWN] and corr_energy[ERR_UP]
+      //from a single calibration lookup and getErrorGeV call
+      void applyEnergyCorrectionsGeV(double cl_eta, double cl_phi, double uncorr_energy, double et,
+				     double corr_energy[3], std::string part_type="ELECTRON" ) const;
+      void applyEnergyCorrectionsMeV(double cl_eta, double cl_phi, double uncorr_energy, double et,
+				     double corr_energy[3], std::string part_type="ELECTRON" ) const;
+
 
       //if can't use the above method then use this method to read the default constants(note they are not egamma default constants
       //but for private use only!)
@@ -69,6 +76,11 @@ class EnergyRescaler {
       double getSmearingCorrectionGeV(double eta, double energy, int value=NOMINAL, bool mc_withCT=true,std::string corr_version="2011" ) ;
       double getSmearingCorrectionMeV(double eta, double energy, int value=NOMINAL, bool mc_withCT=true,std::string corr_version="2011" ) ;
 
+      //nominal, down and up smearing factors (indexed by CorrType) from one random number,
+      //identical to three calls of getSmearingCorrection with the same seed
+      void getSmearingCorrectionsGeV(double eta, double energy, double factors[3], bool mc_withCT=true);
+      void getSmearingCorrectionsMeV(double eta, double energy, double factors[3], bool mc_withCT=true);
+
       /// MC calibration corrections
 
       double applyMCCalibrationGeV(double eta, double ET, std::string ptype);
@@ -104,22 +116,14 @@ class EnergyRescaler {
      
       // end new functions (MB)
 
-      class calibMap { 
-          public:
-     
-               calibMap() { }
-               virtual ~calibMap() { }
-      
+      // A literal type, so that the default tables can be constexpr arrays
+      struct calibMap { 
                 double eta; 
                 double phi; 
                 double etaBinSize; 
                 double phiBinSize; 
                 double alpha; 
                 double alphaErr; 
-  
-                #ifdef ROOTCORE
-                ClassDef(calibMap,1)
-                #endif
       }; 
      
       #ifdef ROOTCORE
@@ -130,7 +134,16 @@ class EnergyRescaler {
       
       mutable TRandom3   m_random3;
 
+      // The corrections in use: either one of the constant default tables,
+      // or m_corrVec as read by readCalibConstants
+      const calibMap*    m_corrTable;
+      unsigned int       m_corrSize;
       std::vector< calibMap > m_corrVec;
+
+      unsigned int nCorrections() const
+      { return m_corrTable ? m_corrSize : m_corrVec.size(); }
+      const calibMap& correction(unsigned int i) const
+      { return m_corrTable ? m_corrTable[i] : m_corrVec[i]; }
  
       
 };
@@ -146,6 +159,19 @@ inline double EnergyRescaler::getSmearingCorrectionMeV(double eta, double energy
   return getSmearingCorrectionGeV(eta, energy/GeV, value, mc_withCT, corr_version);
 }
 
+inline void EnergyRescaler::applyEnergyCorrectionsMeV(double cl_eta, double cl_phi, double uncorr_energy,
+						       double et, double corr_energy[3], std::string part_type) const
+{
+  applyEnergyCorrectionsGeV(cl_eta, cl_phi, uncorr_energy/GeV, et/GeV, corr_energy, part_type);
+  for (int i = 0; i < 3; i++)
+    corr_energy[i] *= GeV;
+}
+
+inline void EnergyRescaler::getSmearingCorrectionsMeV(double eta, double energy, double factors[3], bool mc_withCT)
+{
+  getSmearingCorrectionsGeV(eta, energy/GeV, factors, mc_withCT);
+}
+
 inline double EnergyRescaler::applyMCCalibrationMeV(double eta, double ET, std::string ptype)
 {
   return applyMCCalibrationGeV(eta, ET/GeV, ptype);
@@ -19,6 +19,24 @@ class egammaOQ {
  private:
   vector<double> m_LumiVec;
   vector<double> m_RunFracMC;
+  // getOQWeight of the four MC runs, computed by setLumiVec
+  double m_OQWeight[4];
+
+  // The dead S2 regions of one run period, compiled into a bitmap over the
+  // cells between their eta and phi boundaries. Each boundary value is a
+  // cell of its own, as the regions are closed intervals.
+  struct DeadRegionGrid {
+    int firstRun;
+    vector<double> etaEdges, phiEdges;
+    vector<bool> dead; // [eta cell][phi cell]
+  };
+  vector<DeadRegionGrid> m_deadRegions; //!
+
+  static int gridCell(const vector<double>& edges, double x);
+  bool isDead(const DeadRegionGrid& grid, double eta, double phi) const;
+  const DeadRegionGrid* deadRegionGrid(int runnumber) const;
+  int  deadRegionS2(const DeadRegionGrid& grid, double myEta, double myPhi, double deltaEta, double deltaPhi) const;
+  int  clusterSize(double myEta, int candidate, bool syst, int& netacells, int& nphicells) const;
 
  public:
 
@@ -32,6 +50,8 @@ class egammaOQ {
   int    checkOQClusterElectron(int runnumber, double myEta, double myPhi, bool syst=false, bool verbose=false) const;
   int    checkOQClusterPhoton(int runnumber, double myEta, double myPhi, bool conv, bool syst=false, bool verbose=false) const;
   int    checkOQCluster(double myEta, double myPhi, int NetaCells, int NphiCells, int candidate, bool verbose=false) const;
+  // checkOQClusterPhoton for the n photons of one event, into result[]
+  void   checkOQClusterPhotons(int runnumber, unsigned int n, const double* myEta, const double* myPhi, const bool* conv, int* result, bool syst=false) const;
 
   #ifdef ROOTCORE
   ClassDef(egammaOQ,1)
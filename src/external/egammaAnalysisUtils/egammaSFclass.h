@@ -81,6 +81,7 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <stdexcept>
 
 #ifdef ROOTCORE
 #include "TROOT.h"
@@ -88,6 +89,30 @@
 
 using namespace std;
 
+// Read-only view of one of the constant tables in egammaSFclass.cxx.
+// The tables are static constexpr arrays, so constructing egammaSFclass
+// copies nothing and every instance shares the same read-only data.
+// renorm is applied on access, as copyToVector used to do when filling.
+class SFTable {
+public:
+  SFTable() : m_data(0), m_size(0), m_renorm(1.) {}
+  template <size_t N>
+  SFTable(const float (&data)[N]) : m_data(data), m_size(N), m_renorm(1.) {}
+  SFTable(const float* data, int n, double renorm) : m_data(data), m_size(n), m_renorm(renorm) {}
+
+  size_t size() const { return m_size; }
+  float operator[](size_t i) const { return m_data[i]*m_renorm; }
+  float at(size_t i) const {
+    if (i >= m_size) throw std::out_of_range("SFTable::at");
+    return (*this)[i];
+  }
+
+private:
+  const float* m_data;
+  size_t m_size;
+  double m_renorm;
+};
+
 class egammaSFclass {
 
 public:
@@ -98,6 +123,18 @@ public:
   std::pair<float,float> etCorrection(float ET, int set, int rel=5);
   std::pair<float,float> scaleFactor(float eta, float ET, int set, int range=0, int rel=5, bool etcorrection=true);
 
+  // Compiled lookups: compile() resolves a (set, range, rel, etcorrection)
+  // combination once into flat [ET cell][eta bin] tables of final scale
+  // factors and uncertainties, and returns a handle for them. The results
+  // are exactly those of scaleFactor(), which is called instead (with its
+  // error messages) outside the tables.
+  int compile(int set, int range=0, int rel=5, bool etcorrection=true);
+  std::pair<float,float> compiledScaleFactor(int handle, float eta, float ET);
+  // Every compiled set in handles for n photons: sf and err are filled as
+  // [handle index][photon], so they need handles.size()*n entries
+  void scaleFactors(const std::vector<int>& handles, int n,
+                    const float* eta, const float* ET, float* sf, float* err);
+
 /*   std::pair<float,float> scaleFactorLoose(float eta, float ET=20000., int range=0, int rel=5, bool etcorrection=false) { return scaleFactor(eta, ET, 0, range, rel, etcorrection); }; */
 /*   std::pair<float,float> scaleFactorMedium(float eta, float ET=20000., int range=0, int rel=5, bool etcorrection=false) { return scaleFactor(eta, ET, 1, range, rel, etcorrection); }; */
 /*   std::pair<float,float> scaleFactorTight(float eta, float ET=20000., int range=0, int rel=5, bool etcorrection=false) { return scaleFactor(eta, ET, 2, range, rel, etcorrection); }; */
@@ -116,433 +153,459 @@ public:
     { return scaleFactorForward(eta, 2); };
 
   //For the binning
-  std::vector<float> m_Etabins;
-  std::vector<float> m_FineEtabins;
-  std::vector<float> m_11Etabins;
-  std::vector<float> m_FwdEtabins;
+  SFTable m_Etabins;
+  SFTable m_FineEtabins;
+  SFTable m_11Etabins;
+  SFTable m_FwdEtabins;
 
-  std::vector<float> m_ETbins;
-  std::vector<float> m_ETbinsFullRange;
-  std::vector<float> m_ETbinsTrigger;
+  SFTable m_ETbins;
+  SFTable m_ETbinsFullRange;
+  SFTable m_ETbinsTrigger;
 
   //For the scale factors of the standard egamma cuts 
   //Release 15
   //Probes between 30 and 50 GeV (plateau region)
-  std::vector<float> efficienciesRel15Loose3050;
-  std::vector<float> uncertaintiesRel15Loose3050;
-  std::vector<float> efficienciesRel15Medium3050;
-  std::vector<float> uncertaintiesRel15Medium3050;
-  std::vector<float> efficienciesRel15Tight3050;
-  std::vector<float> uncertaintiesRel15Tight3050;
+  SFTable efficienciesRel15Loose3050;
+  SFTable uncertaintiesRel15Loose3050;
+  SFTable efficienciesRel15Medium3050;
+  SFTable uncertaintiesRel15Medium3050;
+  SFTable efficienciesRel15Tight3050;
+  SFTable uncertaintiesRel15Tight3050;
   //Probes between 20 and 50 GeV
-  std::vector<float> efficienciesRel15Loose2050;
-  std::vector<float> uncertaintiesRel15Loose2050;
-  std::vector<float> efficienciesRel15Medium2050;
-  std::vector<float> uncertaintiesRel15Medium2050;
-  std::vector<float> efficienciesRel15Tight2050;
-  std::vector<float> uncertaintiesRel15Tight2050;
+  SFTable efficienciesRel15Loose2050;
+  SFTable uncertaintiesRel15Loose2050;
+  SFTable efficienciesRel15Medium2050;
+  SFTable uncertaintiesRel15Medium2050;
+  SFTable efficienciesRel15Tight2050;
+  SFTable uncertaintiesRel15Tight2050;
 
   //Release 16
   //Probes between 30 and 50 GeV (plateau region)
-  std::vector<float> efficienciesRel16Medium3050;
-  std::vector<float> uncertaintiesRel16Medium3050;
-  std::vector<float> efficienciesRel16Tight3050;
-  std::vector<float> uncertaintiesRel16Tight3050;
+  SFTable efficienciesRel16Medium3050;
+  SFTable uncertaintiesRel16Medium3050;
+  SFTable efficienciesRel16Tight3050;
+  SFTable uncertaintiesRel16Tight3050;
   //Probes between 20 and 50 GeV
-  std::vector<float> efficienciesRel16Medium2050;
-  std::vector<float> uncertaintiesRel16Medium2050;
-  std::vector<float> efficienciesRel16Tight2050;
-  std::vector<float> uncertaintiesRel16Tight2050;
+  SFTable efficienciesRel16Medium2050;
+  SFTable uncertaintiesRel16Medium2050;
+  SFTable efficienciesRel16Tight2050;
+  SFTable uncertaintiesRel16Tight2050;
 
   //Release 16.6 with 2010 data
   //Probes between 30 and 50 GeV (plateau region)
-  std::vector<float> efficienciesRel166Data2010Medium3050;
-  std::vector<float> uncertaintiesRel166Data2010Medium3050;
-  std::vector<float> efficienciesRel166Data2010Tight3050;
-  std::vector<float> uncertaintiesRel166Data2010Tight3050;
+  SFTable efficienciesRel166Data2010Medium3050;
+  SFTable uncertaintiesRel166Data2010Medium3050;
+  SFTable efficienciesRel166Data2010Tight3050;
+  SFTable uncertaintiesRel166Data2010Tight3050;
   //Probes between 20 and 50 GeV
-  std::vector<float> efficienciesRel166Data2010Medium2050;
-  std::vector<float> uncertaintiesRel166Data2010Medium2050;
-  std::vector<float> efficienciesRel166Data2010Tight2050;
-  std::vector<float> uncertaintiesRel166Data2010Tight2050;
+  SFTable efficienciesRel166Data2010Medium2050;
+  SFTable uncertaintiesRel166Data2010Medium2050;
+  SFTable efficienciesRel166Data2010Tight2050;
+  SFTable uncertaintiesRel166Data2010Tight2050;
 
   //Release 16.6, EPS recommendations
   //Identification for probes between 20 and 50 GeV
-  std::vector<float> efficienciesRel166EPSMedium2050;
-  std::vector<float> uncertaintiesRel166EPSMedium2050;
-  std::vector<float> efficienciesRel166EPSTight2050;
-  std::vector<float> uncertaintiesRel166EPSTight2050;
+  SFTable efficienciesRel166EPSMedium2050;
+  SFTable uncertaintiesRel166EPSMedium2050;
+  SFTable efficienciesRel166EPSTight2050;
+  SFTable uncertaintiesRel166EPSTight2050;
   //Identification for low ET probes
-  std::vector<float> efficienciesRel166EPSMediumLowET;
-  std::vector<float> uncertaintiesRel166EPSMediumLowET;
-  std::vector<float> efficienciesRel166EPSTightLowET;
-  std::vector<float> uncertaintiesRel166EPSTightLowET;
+  SFTable efficienciesRel166EPSMediumLowET;
+  SFTable uncertaintiesRel166EPSMediumLowET;
+  SFTable efficienciesRel166EPSTightLowET;
+  SFTable uncertaintiesRel166EPSTightLowET;
   //For trigger efficiencies on the plateau
-  std::vector<float> efficienciesRel166EPSTrigger;
-  std::vector<float> uncertaintiesRel166EPSTrigger;
+  SFTable efficienciesRel166EPSTrigger;
+  SFTable uncertaintiesRel166EPSTrigger;
   //For reco+trkquality efficiencies
-  std::vector<float> efficienciesRel166EPSRecoTrkQual;
-  std::vector<float> uncertaintiesRel166EPSRecoTrkQual;
+  SFTable efficienciesRel166EPSRecoTrkQual;
+  SFTable uncertaintiesRel166EPSRecoTrkQual;
 
   //For the ET-corrections of the scale factors
   //Release 16
   //Medium
-  std::vector<float> ETCorrectionsMediumRel16;
-  std::vector<float> uncertaintiesETCorrectionsMediumRel16;
+  SFTable ETCorrectionsMediumRel16;
+  SFTable uncertaintiesETCorrectionsMediumRel16;
   //Tight
-  std::vector<float> ETCorrectionsTightRel16;
-  std::vector<float> uncertaintiesETCorrectionsTightRel16;
+  SFTable ETCorrectionsTightRel16;
+  SFTable uncertaintiesETCorrectionsTightRel16;
   //Release 16.6 with 2010 data
   //Medium
-  std::vector<float> ETCorrectionsMediumRel166Data2010;
-  std::vector<float> uncertaintiesETCorrectionsMediumRel166Data2010;
+  SFTable ETCorrectionsMediumRel166Data2010;
+  SFTable uncertaintiesETCorrectionsMediumRel166Data2010;
   //Tight
-  std::vector<float> ETCorrectionsTightRel166Data2010;
-  std::vector<float> uncertaintiesETCorrectionsTightRel166Data2010;
+  SFTable ETCorrectionsTightRel166Data2010;
+  SFTable uncertaintiesETCorrectionsTightRel166Data2010;
   //Release 16.6, EPS recommendations
   //Medium
-  std::vector<float> ETCorrectionsMediumRel166EPS;
-  std::vector<float> uncertaintiesETCorrectionsMediumRel166EPS;
+  SFTable ETCorrectionsMediumRel166EPS;
+  SFTable uncertaintiesETCorrectionsMediumRel166EPS;
   //Tight
-  std::vector<float> ETCorrectionsTightRel166EPS;
-  std::vector<float> uncertaintiesETCorrectionsTightRel166EPS;
+  SFTable ETCorrectionsTightRel166EPS;
+  SFTable uncertaintiesETCorrectionsTightRel166EPS;
   //Release 16.6, EPS recommendations including low ET electrons
   //Medium
-  std::vector<float> ETCorrectionsMediumRel166EPSFullRange;
-  std::vector<float> uncertaintiesETCorrectionsMediumRel166EPSFullRange;
+  SFTable ETCorrectionsMediumRel166EPSFullRange;
+  SFTable uncertaintiesETCorrectionsMediumRel166EPSFullRange;
   //Tight
-  std::vector<float> ETCorrectionsTightRel166EPSFullRange;
-  std::vector<float> uncertaintiesETCorrectionsTightRel166EPSFullRange;
+  SFTable ETCorrectionsTightRel166EPSFullRange;
+  SFTable uncertaintiesETCorrectionsTightRel166EPSFullRange;
 
 
   // Release 17, "CERN Council" recommendations
   // converter
-  void copyToVector(const float *myarray, int n, std::vector<float> &dest, double renorm = 100.);
 
   // For reco+trkquality efficiencies
-  std::vector<float> efficienciesRel17CCRecoTrkQual;
-  std::vector<float> uncertaintiesRel17CCRecoTrkQual;
+  SFTable efficienciesRel17CCRecoTrkQual;
+  SFTable uncertaintiesRel17CCRecoTrkQual;
 
   // Identification eta for probes between 15 and 50 GeV
-  std::vector<float> efficienciesRel17CCLoosePP1550;
-  std::vector<float> uncertaintiesRel17CCLoosePP1550;
-  std::vector<float> efficienciesRel17CCMediumPP1550;
-  std::vector<float> uncertaintiesRel17CCMediumPP1550;
-  std::vector<float> efficienciesRel17CCTightPP1550;
-  std::vector<float> uncertaintiesRel17CCTightPP1550;
+  SFTable efficienciesRel17CCLoosePP1550;
+  SFTable uncertaintiesRel17CCLoosePP1550;
+  SFTable efficienciesRel17CCMediumPP1550;
+  SFTable uncertaintiesRel17CCMediumPP1550;
+  SFTable efficienciesRel17CCTightPP1550;
+  SFTable uncertaintiesRel17CCTightPP1550;
   //Identification eta for low ET probes
-  std::vector<float> efficienciesRel17CCLoosePP415;
-  std::vector<float> uncertaintiesRel17CCLoosePP415;
-  std::vector<float> efficienciesRel17CCMediumPP415;
-  std::vector<float> uncertaintiesRel17CCMediumPP415;
-  std::vector<float> efficienciesRel17CCTightPP415;
-  std::vector<float> uncertaintiesRel17CCTightPP415;
+  SFTable efficienciesRel17CCLoosePP415;
+  SFTable uncertaintiesRel17CCLoosePP415;
+  SFTable efficienciesRel17CCMediumPP415;
+  SFTable uncertaintiesRel17CCMediumPP415;
+  SFTable efficienciesRel17CCTightPP415;
+  SFTable uncertaintiesRel17CCTightPP415;
   // ET correction
-  std::vector<float> ETCorrectionsRel17CCLoosePP;
-  std::vector<float> uncertaintiesETCorrectionsRel17CCLoosePP;
-  std::vector<float> ETCorrectionsRel17CCMediumPP;
-  std::vector<float> uncertaintiesETCorrectionsRel17CCMediumPP;
-  std::vector<float> ETCorrectionsRel17CCTightPP;
-  std::vector<float> uncertaintiesETCorrectionsRel17CCTightPP;
+  SFTable ETCorrectionsRel17CCLoosePP;
+  SFTable uncertaintiesETCorrectionsRel17CCLoosePP;
+  SFTable ETCorrectionsRel17CCMediumPP;
+  SFTable uncertaintiesETCorrectionsRel17CCMediumPP;
+  SFTable ETCorrectionsRel17CCTightPP;
+  SFTable uncertaintiesETCorrectionsRel17CCTightPP;
 
   // Trigger efficiencies
   // e20_medium B-J
-  std::vector<float> MCefficienciesRel17CCe20_mediumLoosePP;
-  std::vector<float> MCefficienciesRel17CCe20_mediumLoosePPET;
+  SFTable MCefficienciesRel17CCe20_mediumLoosePP;
+  SFTable MCefficienciesRel17CCe20_mediumLoosePPET;
 
-  std::vector<float> efficienciesRel17CCe20_mediumMediumPP;
-  std::vector<float> uncertaintiesRel17CCe20_mediumMediumPP;
-  std::vector<float> efficienciesRel17CCe20_mediumMediumPPET;
-  std::vector<float> uncertaintiesRel17CCe20_mediumMediumPPET;
+  SFTable efficienciesRel17CCe20_mediumMediumPP;
+  SFTable uncertaintiesRel17CCe20_mediumMediumPP;
+  SFTable efficienciesRel17CCe20_mediumMediumPPET;
+  SFTable uncertaintiesRel17CCe20_mediumMediumPPET;
 
-  std::vector<float> MCefficienciesRel17CCe20_mediumMediumPP;
-  std::vector<float> MCefficienciesRel17CCe20_mediumMediumPPET;
+  SFTable MCefficienciesRel17CCe20_mediumMediumPP;
+  SFTable MCefficienciesRel17CCe20_mediumMediumPPET;
 
-  std::vector<float> efficienciesRel17CCe20_mediumTightPP;
-  std::vector<float> uncertaintiesRel17CCe20_mediumTightPP;
-  std::vector<float> efficienciesRel17CCe20_mediumTightPPET;
-  std::vector<float> uncertaintiesRel17CCe20_mediumTightPPET;
+  SFTable efficienciesRel17CCe20_mediumTightPP;
+  SFTable uncertaintiesRel17CCe20_mediumTightPP;
+  SFTable efficienciesRel17CCe20_mediumTightPPET;
+  SFTable uncertaintiesRel17CCe20_mediumTightPPET;
 
-  std::vector<float> MCefficienciesRel17CCe20_mediumTightPP;
-  std::vector<float> MCefficienciesRel17CCe20_mediumTightPPET;
+  SFTable MCefficienciesRel17CCe20_mediumTightPP;
+  SFTable MCefficienciesRel17CCe20_mediumTightPPET;
 
 
   // e22_medium K
 
-  std::vector<float> MCefficienciesRel17CCe22_mediumLoosePP;
-  std::vector<float> MCefficienciesRel17CCe22_mediumLoosePPET;
+  SFTable MCefficienciesRel17CCe22_mediumLoosePP;
+  SFTable MCefficienciesRel17CCe22_mediumLoosePPET;
 
-  std::vector<float> efficienciesRel17CCe22_mediumMediumPP;
-  std::vector<float> uncertaintiesRel17CCe22_mediumMediumPP;
-  std::vector<float> efficienciesRel17CCe22_mediumMediumPPET;
-  std::vector<float> uncertaintiesRel17CCe22_mediumMediumPPET;
+  SFTable efficienciesRel17CCe22_mediumMediumPP;
+  SFTable uncertaintiesRel17CCe22_mediumMediumPP;
+  SFTable efficienciesRel17CCe22_mediumMediumPPET;
+  SFTable uncertaintiesRel17CCe22_mediumMediumPPET;
 
-  std::vector<float> MCefficienciesRel17CCe22_mediumMediumPP;
-  std::vector<float> MCefficienciesRel17CCe22_mediumMediumPPET;
+  SFTable MCefficienciesRel17CCe22_mediumMediumPP;
+  SFTable MCefficienciesRel17CCe22_mediumMediumPPET;
 
-  std::vector<float> efficienciesRel17CCe22_mediumTightPP;
-  std::vector<float> uncertaintiesRel17CCe22_mediumTightPP;
-  std::vector<float> efficienciesRel17CCe22_mediumTightPPET;
-  std::vector<float> uncertaintiesRel17CCe22_mediumTightPPET;
+  SFTable efficienciesRel17CCe22_mediumTightPP;
+  SFTable uncertaintiesRel17CCe22_mediumTightPP;
+  SFTable efficienciesRel17CCe22_mediumTightPPET;
+  SFTable uncertaintiesRel17CCe22_mediumTightPPET;
 
-  std::vector<float> MCefficienciesRel17CCe22_mediumTightPP;
-  std::vector<float> MCefficienciesRel17CCe22_mediumTightPPET;
+  SFTable MCefficienciesRel17CCe22_mediumTightPP;
+  SFTable MCefficienciesRel17CCe22_mediumTightPPET;
 
 
   // e22vh_medium1 L-M
-  std::vector<float> MCefficienciesRel17CCe22vh_medium1LoosePP;
-  std::vector<float> MCefficienciesRel17CCe22vh_medium1LoosePPET;
+  SFTable MCefficienciesRel17CCe22vh_medium1LoosePP;
+  SFTable MCefficienciesRel17CCe22vh_medium1LoosePPET;
 
-  std::vector<float> efficienciesRel17CCe22vh_medium1MediumPP;
-  std::vector<float> uncertaintiesRel17CCe22vh_medium1MediumPP;
-  std::vector<float> efficienciesRel17CCe22vh_medium1MediumPPET;
-  std::vector<float> uncertaintiesRel17CCe22vh_medium1MediumPPET;
+  SFTable efficienciesRel17CCe22vh_medium1MediumPP;
+  SFTable uncertaintiesRel17CCe22vh_medium1MediumPP;
+  SFTable efficienciesRel17CCe22vh_medium1MediumPPET;
+  SFTable uncertaintiesRel17CCe22vh_medium1MediumPPET;
 
-  std::vector<float> MCefficienciesRel17CCe22vh_medium1MediumPP;
-  std::vector<float> MCefficienciesRel17CCe22vh_medium1MediumPPET;
+  SFTable MCefficienciesRel17CCe22vh_medium1MediumPP;
+  SFTable MCefficienciesRel17CCe22vh_medium1MediumPPET;
 
-  std::vector<float> efficienciesRel17CCe22vh_medium1TightPP;
-  std::vector<float> uncertaintiesRel17CCe22vh_medium1TightPP;
-  std::vector<float> efficienciesRel17CCe22vh_medium1TightPPET;
-  std::vector<float> uncertaintiesRel17CCe22vh_medium1TightPPET;
+  SFTable efficienciesRel17CCe22vh_medium1TightPP;
+  SFTable uncertaintiesRel17CCe22vh_medium1TightPP;
+  SFTable efficienciesRel17CCe22vh_medium1TightPPET;
+  SFTable uncertaintiesRel17CCe22vh_medium1TightPPET;
 
-  std::vector<float> MCefficienciesRel17CCe22vh_medium1TightPP;
-  std::vector<float> MCefficienciesRel17CCe22vh_medium1TightPPET;
+  SFTable MCefficienciesRel17CCe22vh_medium1TightPP;
+  SFTable MCefficienciesRel17CCe22vh_medium1TightPPET;
 
   // Release 17, "Moriond" recommendations
   // For reco+trkquality efficiencies
-  std::vector<float> efficienciesRel17MoriondRecoTrkQual;
-  std::vector<float> uncertaintiesRel17MoriondRecoTrkQual;
+  SFTable efficienciesRel17MoriondRecoTrkQual;
+  SFTable uncertaintiesRel17MoriondRecoTrkQual;
 
   // Identification eta for probes between 15 and 50 GeV
-  std::vector<float> efficienciesRel17MoriondLoosePP1550;
-  std::vector<float> uncertaintiesRel17MoriondLoosePP1550;
-  std::vector<float> efficienciesRel17MoriondMedium1550;
-  std::vector<float> uncertaintiesRel17MoriondMedium1550;
-  std::vector<float> efficienciesRel17MoriondMediumPP1550;
-  std::vector<float> uncertaintiesRel17MoriondMediumPP1550;
-  std::vector<float> efficienciesRel17MoriondTightPP1550;
-  std::vector<float> uncertaintiesRel17MoriondTightPP1550;
+  SFTable efficienciesRel17MoriondLoosePP1550;
+  SFTable uncertaintiesRel17MoriondLoosePP1550;
+  SFTable efficienciesRel17MoriondMedium1550;
+  SFTable uncertaintiesRel17MoriondMedium1550;
+  SFTable efficienciesRel17MoriondMediumPP1550;
+  SFTable uncertaintiesRel17MoriondMediumPP1550;
+  SFTable efficienciesRel17MoriondTightPP1550;
+  SFTable uncertaintiesRel17MoriondTightPP1550;
   //Identification eta for low ET probes
-  std::vector<float> efficienciesRel17MoriondLoosePP415;
-  std::vector<float> uncertaintiesRel17MoriondLoosePP415;
-  std::vector<float> efficienciesRel17MoriondMedium415;
-  std::vector<float> uncertaintiesRel17MoriondMedium415;
-  std::vector<float> efficienciesRel17MoriondMediumPP415;
-  std::vector<float> uncertaintiesRel17MoriondMediumPP415;
-  std::vector<float> efficienciesRel17MoriondTightPP415;
-  std::vector<float> uncertaintiesRel17MoriondTightPP415;
+  SFTable efficienciesRel17MoriondLoosePP415;
+  SFTable uncertaintiesRel17MoriondLoosePP415;
+  SFTable efficienciesRel17MoriondMedium415;
+  SFTable uncertaintiesRel17MoriondMedium415;
+  SFTable efficienciesRel17MoriondMediumPP415;
+  SFTable uncertaintiesRel17MoriondMediumPP415;
+  SFTable efficienciesRel17MoriondTightPP415;
+  SFTable uncertaintiesRel17MoriondTightPP415;
   // ET correction
-  std::vector<float> ETCorrectionsRel17MoriondLoosePP;
-  std::vector<float> uncertaintiesETCorrectionsRel17MoriondLoosePP;
-  std::vector<float> ETCorrectionsRel17MoriondMedium;
-  std::vector<float> uncertaintiesETCorrectionsRel17MoriondMedium;
-  std::vector<float> ETCorrectionsRel17MoriondMediumPP;
-  std::vector<float> uncertaintiesETCorrectionsRel17MoriondMediumPP;
-  std::vector<float> ETCorrectionsRel17MoriondTightPP;
-  std::vector<float> uncertaintiesETCorrectionsRel17MoriondTightPP;
+  SFTable ETCorrectionsRel17MoriondLoosePP;
+  SFTable uncertaintiesETCorrectionsRel17MoriondLoosePP;
+  SFTable ETCorrectionsRel17MoriondMedium;
+  SFTable uncertaintiesETCorrectionsRel17MoriondMedium;
+  SFTable ETCorrectionsRel17MoriondMediumPP;
+  SFTable uncertaintiesETCorrectionsRel17MoriondMediumPP;
+  SFTable ETCorrectionsRel17MoriondTightPP;
+  SFTable uncertaintiesETCorrectionsRel17MoriondTightPP;
 
   // Forward electron Identification eta for probes >20 GeV
-  std::vector<float> efficienciesRel17MoriondForwardLoose;
-  std::vector<float> uncertaintiesRel17MoriondForwardLoose;
-  std::vector<float> efficienciesRel17MoriondForwardTight;
-  std::vector<float> uncertaintiesRel17MoriondForwardTight;
+  SFTable efficienciesRel17MoriondForwardLoose;
+  SFTable uncertaintiesRel17MoriondForwardLoose;
+  SFTable efficienciesRel17MoriondForwardTight;
+  SFTable uncertaintiesRel17MoriondForwardTight;
 
-  std::vector<float> efficienciesRel17MoriondFrozenShowersForwardLoose;
-  std::vector<float> efficienciesRel17MoriondFrozenShowersForwardTight;
+  SFTable efficienciesRel17MoriondFrozenShowersForwardLoose;
+  SFTable efficienciesRel17MoriondFrozenShowersForwardTight;
 
   // Trigger efficiencies
   // e20_medium B-J
-  std::vector<float> MCefficienciesRel17Morionde20_mediumLoosePP;
-  std::vector<float> MCefficienciesRel17Morionde20_mediumLoosePPET;
+  SFTable MCefficienciesRel17Morionde20_mediumLoosePP;
+  SFTable MCefficienciesRel17Morionde20_mediumLoosePPET;
 
-  std::vector<float> efficienciesRel17Morionde20_mediumLoosePP;
-  std::vector<float> uncertaintiesRel17Morionde20_mediumLoosePP;
-  std::vector<float> efficienciesRel17Morionde20_mediumLoosePPET;
-  std::vector<float> uncertaintiesRel17Morionde20_mediumLoosePPET;
+  SFTable efficienciesRel17Morionde20_mediumLoosePP;
+  SFTable uncertaintiesRel17Morionde20_mediumLoosePP;
+  SFTable efficienciesRel17Morionde20_mediumLoosePPET;
+  SFTable uncertaintiesRel17Morionde20_mediumLoosePPET;
 
-  std::vector<float> efficienciesRel17Morionde20_mediumMediumPP;
-  std::vector<float> uncertaintiesRel17Morionde20_mediumMediumPP;
-  std::vector<float> efficienciesRel17Morionde20_mediumMediumPPET;
-  std::vector<float> uncertaintiesRel17Morionde20_mediumMediumPPET;
+  SFTable efficienciesRel17Morionde20_mediumMediumPP;
+  SFTable uncertaintiesRel17Morionde20_mediumMediumPP;
+  SFTable efficienciesRel17Morionde20_mediumMediumPPET;
+  SFTable uncertaintiesRel17Morionde20_mediumMediumPPET;
 
 
-  std::vector<float> MCefficienciesRel17Morionde20_mediumMediumPP;
-  std::vector<float> MCefficienciesRel17Morionde20_mediumMediumPPET;
+  SFTable MCefficienciesRel17Morionde20_mediumMediumPP;
+  SFTable MCefficienciesRel17Morionde20_mediumMediumPPET;
 
-  std::vector<float> efficienciesRel17Morionde20_mediumTightPP;
-  std::vector<float> uncertaintiesRel17Morionde20_mediumTightPP;
-  std::vector<float> efficienciesRel17Morionde20_mediumTightPPET;
-  std::vector<float> uncertaintiesRel17Morionde20_mediumTightPPET;
+  SFTable efficienciesRel17Morionde20_mediumTightPP;
+  SFTable uncertaintiesRel17Morionde20_mediumTightPP;
+  SFTable efficienciesRel17Morionde20_mediumTightPPET;
+  SFTable uncertaintiesRel17Morionde20_mediumTightPPET;
 
-  std::vector<float> MCefficienciesRel17Morionde20_mediumTightPP;
-  std::vector<float> MCefficienciesRel17Morionde20_mediumTightPPET;
+  SFTable MCefficienciesRel17Morionde20_mediumTightPP;
+  SFTable MCefficienciesRel17Morionde20_mediumTightPPET;
 
 
   // e22_medium K
 
-  std::vector<float> MCefficienciesRel17Morionde22_mediumLoosePP;
-  std::vector<float> MCefficienciesRel17Morionde22_mediumLoosePPET;
+  SFTable MCefficienciesRel17Morionde22_mediumLoosePP;
+  SFTable MCefficienciesRel17Morionde22_mediumLoosePPET;
 
-  std::vector<float> efficienciesRel17Morionde22_mediumLoosePP;
-  std::vector<float> uncertaintiesRel17Morionde22_mediumLoosePP;
-  std::vector<float> efficienciesRel17Morionde22_mediumLoosePPET;
-  std::vector<float> uncertaintiesRel17Morionde22_mediumLoosePPET;
+  SFTable efficienciesRel17Morionde22_mediumLoosePP;
+  SFTable uncertaintiesRel17Morionde22_mediumLoosePP;
+  SFTable efficienciesRel17Morionde22_mediumLoosePPET;
+  SFTable uncertaintiesRel17Morionde22_mediumLoosePPET;
 
-  std::vector<float> efficienciesRel17Morionde22_mediumMediumPP;
-  std::vector<float> uncertaintiesRel17Morionde22_mediumMediumPP;
-  std::vector<float> efficienciesRel17Morionde22_mediumMediumPPET;
-  std::vector<float> uncertaintiesRel17Morionde22_mediumMediumPPET;
+  SFTable efficienciesRel17Morionde22_mediumMediumPP;
+  SFTable uncertaintiesRel17Morionde22_mediumMediumPP;
+  SFTable efficienciesRel17Morionde22_mediumMediumPPET;
+  SFTable uncertaintiesRel17Morionde22_mediumMediumPPET;
 
-  std::vector<float> MCefficienciesRel17Morionde22_mediumMediumPP;
-  std::vector<float> MCefficienciesRel17Morionde22_mediumMediumPPET;
+  SFTable MCefficienciesRel17Morionde22_mediumMediumPP;
+  SFTable MCefficienciesRel17Morionde22_mediumMediumPPET;
 
-  std::vector<float> efficienciesRel17Morionde22_mediumTightPP;
-  std::vector<float> uncertaintiesRel17Morionde22_mediumTightPP;
-  std::vector<float> efficienciesRel17Morionde22_mediumTightPPET;
-  std::vector<float> uncertaintiesRel17Morionde22_mediumTightPPET;
+  SFTable efficienciesRel17Morionde22_mediumTightPP;
+  SFTable uncertaintiesRel17Morionde22_mediumTightPP;
+  SFTable efficienciesRel17Morionde22_mediumTightPPET;
+  SFTable uncertaintiesRel17Morionde22_mediumTightPPET;
 
-  std::vector<float> MCefficienciesRel17Morionde22_mediumTightPP;
-  std::vector<float> MCefficienciesRel17Morionde22_mediumTightPPET;
+  SFTable MCefficienciesRel17Morionde22_mediumTightPP;
+  SFTable MCefficienciesRel17Morionde22_mediumTightPPET;
 
 
   // e22vh_medium1 L-M
-  std::vector<float> MCefficienciesRel17Morionde22vh_medium1LoosePP;
-  std::vector<float> MCefficienciesRel17Morionde22vh_medium1LoosePPET;
+  SFTable MCefficienciesRel17Morionde22vh_medium1LoosePP;
+  SFTable MCefficienciesRel17Morionde22vh_medium1LoosePPET;
 
-  std::vector<float> efficienciesRel17Morionde22vh_medium1LoosePP;
-  std::vector<float> uncertaintiesRel17Morionde22vh_medium1LoosePP;
-  std::vector<float> efficienciesRel17Morionde22vh_medium1LoosePPET;
-  std::vector<float> uncertaintiesRel17Morionde22vh_medium1LoosePPET;
+  SFTable efficienciesRel17Morionde22vh_medium1LoosePP;
+  SFTable uncertaintiesRel17Morionde22vh_medium1LoosePP;
+  SFTable efficienciesRel17Morionde22vh_medium1LoosePPET;
+  SFTable uncertaintiesRel17Morionde22vh_medium1LoosePPET;
 
-  std::vector<float> efficienciesRel17Morionde22vh_medium1MediumPP;
-  std::vector<float> uncertaintiesRel17Morionde22vh_medium1MediumPP;
-  std::vector<float> efficienciesRel17Morionde22vh_medium1MediumPPET;
-  std::vector<float> uncertaintiesRel17Morionde22vh_medium1MediumPPET;
+  SFTable efficienciesRel17Morionde22vh_medium1MediumPP;
+  SFTable uncertaintiesRel17Morionde22vh_medium1MediumPP;
+  SFTable efficienciesRel17Morionde22vh_medium1MediumPPET;
+  SFTable uncertaintiesRel17Morionde22vh_medium1MediumPPET;
 
-  std::vector<float> MCefficienciesRel17Morionde22vh_medium1MediumPP;
-  std::vector<float> MCefficienciesRel17Morionde22vh_medium1MediumPPET;
+  SFTable MCefficienciesRel17Morionde22vh_medium1MediumPP;
+  SFTable MCefficienciesRel17Morionde22vh_medium1MediumPPET;
 
-  std::vector<float> efficienciesRel17Morionde22vh_medium1TightPP;
-  std::vector<float> uncertaintiesRel17Morionde22vh_medium1TightPP;
-  std::vector<float> efficienciesRel17Morionde22vh_medium1TightPPET;
-  std::vector<float> uncertaintiesRel17Morionde22vh_medium1TightPPET;
+  SFTable efficienciesRel17Morionde22vh_medium1TightPP;
+  SFTable uncertaintiesRel17Morionde22vh_medium1TightPP;
+  SFTable efficienciesRel17Morionde22vh_medium1TightPPET;
+  SFTable uncertaintiesRel17Morionde22vh_medium1TightPPET;
 
-  std::vector<float> MCefficienciesRel17Morionde22vh_medium1TightPP;
-  std::vector<float> MCefficienciesRel17Morionde22vh_medium1TightPPET;
+  SFTable MCefficienciesRel17Morionde22vh_medium1TightPP;
+  SFTable MCefficienciesRel17Morionde22vh_medium1TightPPET;
 
   // Release 17, "Moriond" recommendations - AFII samples
   // For reco+trkquality efficiencies
-  std::vector<float> efficienciesRel17MoriondAFIIRecoTrkQual;
-  std::vector<float> uncertaintiesRel17MoriondAFIIRecoTrkQual;
+  SFTable efficienciesRel17MoriondAFIIRecoTrkQual;
+  SFTable uncertaintiesRel17MoriondAFIIRecoTrkQual;
 
   // Identification eta for probes between 15 and 50 GeV
-  std::vector<float> efficienciesRel17MoriondAFIILoosePP1550;
-  std::vector<float> uncertaintiesRel17MoriondAFIILoosePP1550;
-  std::vector<float> efficienciesRel17MoriondAFIIMedium1550;
-  std::vector<float> uncertaintiesRel17MoriondAFIIMedium1550;
-  std::vector<float> efficienciesRel17MoriondAFIIMediumPP1550;
-  std::vector<float> uncertaintiesRel17MoriondAFIIMediumPP1550;
-  std::vector<float> efficienciesRel17MoriondAFIITightPP1550;
-  std::vector<float> uncertaintiesRel17MoriondAFIITightPP1550;
+  SFTable efficienciesRel17MoriondAFIILoosePP1550;
+  SFTable uncertaintiesRel17MoriondAFIILoosePP1550;
+  SFTable efficienciesRel17MoriondAFIIMedium1550;
+  SFTable uncertaintiesRel17MoriondAFIIMedium1550;
+  SFTable efficienciesRel17MoriondAFIIMediumPP1550;
+  SFTable uncertaintiesRel17MoriondAFIIMediumPP1550;
+  SFTable efficienciesRel17MoriondAFIITightPP1550;
+  SFTable uncertaintiesRel17MoriondAFIITightPP1550;
   //Identification eta for low ET probes
-  std::vector<float> efficienciesRel17MoriondAFIILoosePP415;
-  std::vector<float> uncertaintiesRel17MoriondAFIILoosePP415;
-  std::vector<float> efficienciesRel17MoriondAFIIMedium415;
-  std::vector<float> uncertaintiesRel17MoriondAFIIMedium415;
-  std::vector<float> efficienciesRel17MoriondAFIIMediumPP415;
-  std::vector<float> uncertaintiesRel17MoriondAFIIMediumPP415;
-  std::vector<float> efficienciesRel17MoriondAFIITightPP415;
-  std::vector<float> uncertaintiesRel17MoriondAFIITightPP415;
+  SFTable efficienciesRel17MoriondAFIILoosePP415;
+  SFTable uncertaintiesRel17MoriondAFIILoosePP415;
+  SFTable efficienciesRel17MoriondAFIIMedium415;
+  SFTable uncertaintiesRel17MoriondAFIIMedium415;
+  SFTable efficienciesRel17MoriondAFIIMediumPP415;
+  SFTable uncertaintiesRel17MoriondAFIIMediumPP415;
+  SFTable efficienciesRel17MoriondAFIITightPP415;
+  SFTable uncertaintiesRel17MoriondAFIITightPP415;
   // ET correction
-  std::vector<float> ETCorrectionsRel17MoriondAFIILoosePP;
-  std::vector<float> uncertaintiesETCorrectionsRel17MoriondAFIILoosePP;
-  std::vector<float> ETCorrectionsRel17MoriondAFIIMedium;
-  std::vector<float> uncertaintiesETCorrectionsRel17MoriondAFIIMedium;
-  std::vector<float> ETCorrectionsRel17MoriondAFIIMediumPP;
-  std::vector<float> uncertaintiesETCorrectionsRel17MoriondAFIIMediumPP;
-  std::vector<float> ETCorrectionsRel17MoriondAFIITightPP;
-  std::vector<float> uncertaintiesETCorrectionsRel17MoriondAFIITightPP;
+  SFTable ETCorrectionsRel17MoriondAFIILoosePP;
+  SFTable uncertaintiesETCorrectionsRel17MoriondAFIILoosePP;
+  SFTable ETCorrectionsRel17MoriondAFIIMedium;
+  SFTable uncertaintiesETCorrectionsRel17MoriondAFIIMedium;
+  SFTable ETCorrectionsRel17MoriondAFIIMediumPP;
+  SFTable uncertaintiesETCorrectionsRel17MoriondAFIIMediumPP;
+  SFTable ETCorrectionsRel17MoriondAFIITightPP;
+  SFTable uncertaintiesETCorrectionsRel17MoriondAFIITightPP;
 
   // Trigger efficiencies
   // e20_medium B-J
-  std::vector<float> MCefficienciesRel17MoriondAFIIe20_mediumLoosePP;
-  std::vector<float> MCefficienciesRel17MoriondAFIIe20_mediumLoosePPET;
+  SFTable MCefficienciesRel17MoriondAFIIe20_mediumLoosePP;
+  SFTable MCefficienciesRel17MoriondAFIIe20_mediumLoosePPET;
 
-  std::vector<float> efficienciesRel17MoriondAFIIe20_mediumLoosePP;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe20_mediumLoosePP;
-  std::vector<float> efficienciesRel17MoriondAFIIe20_mediumLoosePPET;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe20_mediumLoosePPET;
+  SFTable efficienciesRel17MoriondAFIIe20_mediumLoosePP;
+  SFTable uncertaintiesRel17MoriondAFIIe20_mediumLoosePP;
+  SFTable efficienciesRel17MoriondAFIIe20_mediumLoosePPET;
+  SFTable uncertaintiesRel17MoriondAFIIe20_mediumLoosePPET;
 
-  std::vector<float> efficienciesRel17MoriondAFIIe20_mediumMediumPP;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe20_mediumMediumPP;
-  std::vector<float> efficienciesRel17MoriondAFIIe20_mediumMediumPPET;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe20_mediumMediumPPET;
+  SFTable efficienciesRel17MoriondAFIIe20_mediumMediumPP;
+  SFTable uncertaintiesRel17MoriondAFIIe20_mediumMediumPP;
+  SFTable efficienciesRel17MoriondAFIIe20_mediumMediumPPET;
+  SFTable uncertaintiesRel17MoriondAFIIe20_mediumMediumPPET;
 
-  std::vector<float> MCefficienciesRel17MoriondAFIIe20_mediumMediumPP;
-  std::vector<float> MCefficienciesRel17MoriondAFIIe20_mediumMediumPPET;
+  SFTable MCefficienciesRel17MoriondAFIIe20_mediumMediumPP;
+  SFTable MCefficienciesRel17MoriondAFIIe20_mediumMediumPPET;
 
-  std::vector<float> efficienciesRel17MoriondAFIIe20_mediumTightPP;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe20_mediumTightPP;
-  std::vector<float> efficienciesRel17MoriondAFIIe20_mediumTightPPET;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe20_mediumTightPPET;
+  SFTable efficienciesRel17MoriondAFIIe20_mediumTightPP;
+  SFTable uncertaintiesRel17MoriondAFIIe20_mediumTightPP;
+  SFTable efficienciesRel17MoriondAFIIe20_mediumTightPPET;
+  SFTable uncertaintiesRel17MoriondAFIIe20_mediumTightPPET;
 
-  std::vector<float> MCefficienciesRel17MoriondAFIIe20_mediumTightPP;
-  std::vector<float> MCefficienciesRel17MoriondAFIIe20_mediumTightPPET;
+  SFTable MCefficienciesRel17MoriondAFIIe20_mediumTightPP;
+  SFTable MCefficienciesRel17MoriondAFIIe20_mediumTightPPET;
 
 
   // e22_medium K
 
-  std::vector<float> MCefficienciesRel17MoriondAFIIe22_mediumLoosePP;
-  std::vector<float> MCefficienciesRel17MoriondAFIIe22_mediumLoosePPET;
+  SFTable MCefficienciesRel17MoriondAFIIe22_mediumLoosePP;
+  SFTable MCefficienciesRel17MoriondAFIIe22_mediumLoosePPET;
 
-  std::vector<float> efficienciesRel17MoriondAFIIe22_mediumMediumPP;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe22_mediumMediumPP;
-  std::vector<float> efficienciesRel17MoriondAFIIe22_mediumMediumPPET;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe22_mediumMediumPPET;
+  SFTable efficienciesRel17MoriondAFIIe22_mediumMediumPP;
+  SFTable uncertaintiesRel17MoriondAFIIe22_mediumMediumPP;
+  SFTable efficienciesRel17MoriondAFIIe22_mediumMediumPPET;
+  SFTable uncertaintiesRel17MoriondAFIIe22_mediumMediumPPET;
 
-  std::vector<float> efficienciesRel17MoriondAFIIe22_mediumLoosePP;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe22_mediumLoosePP;
-  std::vector<float> efficienciesRel17MoriondAFIIe22_mediumLoosePPET;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe22_mediumLoosePPET;
+  SFTable efficienciesRel17MoriondAFIIe22_mediumLoosePP;
+  SFTable uncertaintiesRel17MoriondAFIIe22_mediumLoosePP;
+  SFTable efficienciesRel17MoriondAFIIe22_mediumLoosePPET;
+  SFTable uncertaintiesRel17MoriondAFIIe22_mediumLoosePPET;
 
-  std::vector<float> MCefficienciesRel17MoriondAFIIe22_mediumMediumPP;
-  std::vector<float> MCefficienciesRel17MoriondAFIIe22_mediumMediumPPET;
+  SFTable MCefficienciesRel17MoriondAFIIe22_mediumMediumPP;
+  SFTable MCefficienciesRel17MoriondAFIIe22_mediumMediumPPET;
 
-  std::vector<float> efficienciesRel17MoriondAFIIe22_mediumTightPP;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe22_mediumTightPP;
-  std::vector<float> efficienciesRel17MoriondAFIIe22_mediumTightPPET;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe22_mediumTightPPET;
+  SFTable efficienciesRel17MoriondAFIIe22_mediumTightPP;
+  SFTable uncertaintiesRel17MoriondAFIIe22_mediumTightPP;
+  SFTable efficienciesRel17MoriondAFIIe22_mediumTightPPET;
+  SFTable uncertaintiesRel17MoriondAFIIe22_mediumTightPPET;
 
-  std::vector<float> MCefficienciesRel17MoriondAFIIe22_mediumTightPP;
-  std::vector<float> MCefficienciesRel17MoriondAFIIe22_mediumTightPPET;
+  SFTable MCefficienciesRel17MoriondAFIIe22_mediumTightPP;
+  SFTable MCefficienciesRel17MoriondAFIIe22_mediumTightPPET;
 
 
   // e22vh_medium1 L-M
-  std::vector<float> MCefficienciesRel17MoriondAFIIe22vh_medium1LoosePP;
-  std::vector<float> MCefficienciesRel17MoriondAFIIe22vh_medium1LoosePPET;
-
-  std::vector<float> efficienciesRel17MoriondAFIIe22vh_medium1LoosePP;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe22vh_medium1LoosePP;
-  std::vector<float> efficienciesRel17MoriondAFIIe22vh_medium1LoosePPET;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe22vh_medium1LoosePPET;
-
-  std::vector<float> efficienciesRel17MoriondAFIIe22vh_medium1MediumPP;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe22vh_medium1MediumPP;
-  std::vector<float> efficienciesRel17MoriondAFIIe22vh_medium1MediumPPET;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe22vh_medium1MediumPPET;
-
-  std::vector<float> MCefficienciesRel17MoriondAFIIe22vh_medium1MediumPP;
-  std::vector<float> MCefficienciesRel17MoriondAFIIe22vh_medium1MediumPPET;
-
-  std::vector<float> efficienciesRel17MoriondAFIIe22vh_medium1TightPP;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe22vh_medium1TightPP;
-  std::vector<float> efficienciesRel17MoriondAFIIe22vh_medium1TightPPET;
-  std::vector<float> uncertaintiesRel17MoriondAFIIe22vh_medium1TightPPET;
-
-  std::vector<float> MCefficienciesRel17MoriondAFIIe22vh_medium1TightPP;
-  std::vector<float> MCefficienciesRel17MoriondAFIIe22vh_medium1TightPPET;
-
+  SFTable MCefficienciesRel17MoriondAFIIe22vh_medium1LoosePP;
+  SFTable MCefficienciesRel17MoriondAFIIe22vh_medium1LoosePPET;
+
+  SFTable efficienciesRel17MoriondAFIIe22vh_medium1LoosePP;
+  SFTable uncertaintiesRel17MoriondAFIIe22vh_medium1LoosePP;
+  SFTable efficienciesRel17MoriondAFIIe22vh_medium1LoosePPET;
+  SFTable uncertaintiesRel17MoriondAFIIe22vh_medium1LoosePPET;
+
+  SFTable efficienciesRel17MoriondAFIIe22vh_medium1MediumPP;
+  SFTable uncertaintiesRel17MoriondAFIIe22vh_medium1MediumPP;
+  SFTable efficienciesRel17MoriondAFIIe22vh_medium1MediumPPET;
+  SFTable uncertaintiesRel17MoriondAFIIe22vh_medium1MediumPPET;
+
+  SFTable MCefficienciesRel17MoriondAFIIe22vh_medium1MediumPP;
+  SFTable MCefficienciesRel17MoriondAFIIe22vh_medium1MediumPPET;
+
+  SFTable efficienciesRel17MoriondAFIIe22vh_medium1TightPP;
+  SFTable uncertaintiesRel17MoriondAFIIe22vh_medium1TightPP;
+  SFTable efficienciesRel17MoriondAFIIe22vh_medium1TightPPET;
+  SFTable uncertaintiesRel17MoriondAFIIe22vh_medium1TightPPET;
+
+  SFTable MCefficienciesRel17MoriondAFIIe22vh_medium1TightPP;
+  SFTable MCefficienciesRel17MoriondAFIIe22vh_medium1TightPPET;
+
+
+private:
+  bool selectTables(float eta, float ET, int set, int range, int rel, bool& etcorrection,
+                    const SFTable*& vectEff, const SFTable*& vectUnc,
+                    const SFTable*& vectEtaBinning, bool& doAbsEta,
+                    std::pair<float,float>& early);
+  static std::pair<float,float> binScaleFactor(const SFTable* vectEff, const SFTable* vectUnc, int ietabin);
+  static std::pair<float,float> applyEtCorrection(std::pair<float,float> sf, std::pair<float,float> corr);
+
+  // nEdges == 0: not tabulated, use scaleFactor()
+  struct CompiledCell {
+    int edges, nEdges, values;
+    bool absEta;
+  };
+  struct CompiledSet {
+    int set, range, rel;
+    bool etcorrection;
+    std::vector<CompiledCell> cells;
+    std::vector<float> etaEdges, sf, err;
+  };
+
+  int etCell(float ET) const;
+  std::pair<float,float> lookup(const CompiledSet& c, int icell, float eta, float ET);
+
+  std::vector<float> m_cellETedges; //!
+  std::vector<CompiledSet> m_compiled; //!
+  bool m_quiet; //!
 
   #ifdef ROOTCORE
   ClassDef(egammaSFclass,1)
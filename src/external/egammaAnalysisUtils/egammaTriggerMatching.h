@@ -53,4 +53,11 @@ if ( el_tracketa->at(offI), el_trackphi->at(offI), trig_EF_el_EF_e60_loose, EFin
 bool PassedTriggerEF(double etaOff, double phiOff, std::vector<int> *EFdecision, int &EFindex, 
 		     unsigned int nEFObject, std::vector<float> *EFetaVector, std::vector<float> *EFphiVector);
 
+// Matches all nOffObject offline objects of an event in one pass, binning the EF objects in eta-phi.
+// EFindex[i] is set as PassedTriggerEF would for object i (-1 if not matched).
+// Returns the number of matched offline objects.
+unsigned int MatchTriggerEF(unsigned int nOffObject, const double *etaOff, const double *phiOff,
+                            unsigned int nEFObject, const int *EFdecision,
+                            const float *EFetaVector, const float *EFphiVector, int *EFindex);
+
 #endif 
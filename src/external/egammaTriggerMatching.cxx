@@ -4,6 +4,7 @@
 #include <string>
 #include <iostream>
 #include <cmath>
+#include <algorithm>
 
 /*
 -----------------------------------------------------------------------
@@ -117,3 +118,84 @@ bool  PassedTriggerEF(double etaOff, double phiOff, std::vector<int> *EFdecision
   EFindex=-1;
   return false;
 }
+
+/*
+MatchTriggerEF: same matching as PassedTriggerEF for all the offline objects of an event at once.
+
+The EF objects passing the trigger are sorted into eta-phi bins slightly larger than the matching
+cone (phi bins wrap around at +-pi), so each offline object is only compared with the objects in
+the 3x3 bins around its own. The closest one is picked with the same deltaR and, on ties, the
+lowest index, so EFindex[i] is exactly what PassedTriggerEF would return for object i (-1 if not
+matched). Objects with coordinates outside the binned range are compared with everything.
+*/
+
+namespace {
+  const double etaBinSize=0.16;
+  const int nPhiBins=int(2*M_PI/0.16);
+  const double phiBinSize=2*M_PI/nPhiBins;
+  const double maxBinnedEta=100;
+
+  bool GetEtaPhiBin(double eta, double phi, int &etaBin, int &phiBin) {
+    if (!(fabs(eta)<maxBinnedEta && fabs(phi)<=M_PI)) return false;
+    etaBin=int(floor(eta/etaBinSize));
+    phiBin=int((phi+M_PI)/phiBinSize);
+    if (phiBin>=nPhiBins) phiBin=nPhiBins-1;
+    return true;
+  }
+
+  void TestEFObject(double etaOff, double phiOff, int j, const float *EFetaVector, const float *EFphiVector,
+                    double &dRMax, int &EFindex) {
+    double etaEF=EFetaVector[j];
+    double phiEF=EFphiVector[j];
+    double deltaR=sqrt(pow(GetDPhi(phiEF,phiOff),2)+pow(etaOff-etaEF,2));
+    if ( deltaR<dRMax || (deltaR==dRMax && j<EFindex) ) {
+      dRMax=deltaR;
+      EFindex=j;
+    }
+  }
+}
+
+unsigned int MatchTriggerEF(unsigned int nOffObject, const double *etaOff, const double *phiOff,
+                            unsigned int nEFObject, const int *EFdecision,
+                            const float *EFetaVector, const float *EFphiVector, int *EFindex) {
+  // passing EF objects: (bin, index) sorted by bin, and the ones that can't be binned
+  std::vector<std::pair<int, int> > binned;
+  std::vector<int> unbinned;
+  for (unsigned int j=0;j<nEFObject;j++) {
+    if ( EFdecision[j]==0 ) continue;
+    int etaBin, phiBin;
+    if (GetEtaPhiBin(EFetaVector[j], EFphiVector[j], etaBin, phiBin))
+      binned.push_back(std::make_pair(etaBin*nPhiBins+phiBin, int(j)));
+    else
+      unbinned.push_back(j);
+  }
+  std::sort(binned.begin(), binned.end());
+
+  unsigned int nMatched=0;
+  for (unsigned int i=0;i<nOffObject;i++) {
+    double dRMax=100;
+    EFindex[i]=-1;
+
+    int etaBin, phiBin;
+    if (GetEtaPhiBin(etaOff[i], phiOff[i], etaBin, phiBin)) {
+      for (int dEta=-1;dEta<=1;dEta++) {
+        for (int dPhi=-1;dPhi<=1;dPhi++) {
+          int bin=(etaBin+dEta)*nPhiBins+(phiBin+dPhi+nPhiBins)%nPhiBins;
+          std::vector<std::pair<int, int> >::const_iterator it=
+            std::lower_bound(binned.begin(), binned.end(), std::make_pair(bin, -1));
+          for (;it!=binned.end() && it->first==bin;++it)
+            TestEFObject(etaOff[i], phiOff[i], it->second, EFetaVector, EFphiVector, dRMax, EFindex[i]);
+        }
+      }
+    } else {
+      for (unsigned int k=0;k<binned.size();k++)
+        TestEFObject(etaOff[i], phiOff[i], binned[k].second, EFetaVector, EFphiVector, dRMax, EFindex[i]);
+    }
+    for (unsigned int k=0;k<unbinned.size();k++)
+      TestEFObject(etaOff[i], phiOff[i], unbinned[k], EFetaVector, EFphiVector, dRMax, EFindex[i]);
+
+    if ( dRMax<=m_triggerDrMatchingCut ) nMatched++;
+    else EFindex[i]=-1;
+  }
+  return nMatched;
+}
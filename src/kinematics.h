@@ -0,0 +1,88 @@
+#ifndef _KINEMATICS_H_
+#define _KINEMATICS_H_
+
+#include <math.h>
+#include <float.h>
+#include <vector>
+
+namespace ana {
+
+/// Photon energy and unit direction seen from the primary vertex.
+///
+/// Same physics as GetCorrectedInvMass() in external.cxx: the first sampling
+/// eta is projected onto the calorimeter front (ReturnRZ_1stSampling_cscopt2)
+/// and the direction is recomputed relative to the vertex z. Here it is done
+/// once per photon in double precision and without TLorentzVector, so that
+/// any number of pairings only costs a dot product each.
+struct PhotonDirection {
+    double e, nx, ny, nz;
+
+    PhotonDirection() : e(0), nx(0), ny(0), nz(0) {}
+
+    PhotonDirection(const double energy, const double eta_s1,
+                    const double phi, const double z_vertex)
+        : e(energy)
+    {
+        // sinh of the vertex corrected eta
+        const double s = vertex_corrected_sinh_eta(eta_s1, z_vertex);
+        const double sin_theta = 1 / sqrt(1 + s*s);
+        nx = sin_theta * cos(phi);
+        ny = sin_theta * sin(phi);
+        nz = sin_theta * s;
+    }
+
+    static double vertex_corrected_sinh_eta(const double eta_s1, const double z_vertex) {
+        const double aeta = fabs(eta_s1);
+        if (aeta < 1.5) {
+            // Barrel: radius of the front of the first sampling
+            const double R = aeta < 0.8
+                ? 1558.859292 - 4.990838*aeta - 21.144279*aeta*aeta
+                : 1522.775373 + 27.970192*aeta - 21.104108*aeta*aeta;
+            return sinh(eta_s1) - z_vertex / R;
+        }
+        // Endcap: z of the front of the first sampling
+        const double Z = eta_s1 < 0 ? -3790.671754 : 3790.671754;
+        return sinh(eta_s1) * (1 - z_vertex / Z);
+    }
+
+    double pt() const { return e * sqrt(nx*nx + ny*ny); }
+    double eta() const { return asinh(nz / sqrt(nx*nx + ny*ny)); }
+};
+
+/// Invariant mass of two massless photons
+inline double diphoton_mass(const PhotonDirection& a, const PhotonDirection& b) {
+    const double m2 = 2 * a.e * b.e * (1 - (a.nx*b.nx + a.ny*b.ny + a.nz*b.nz));
+    return m2 > 0 ? sqrt(m2) : 0;
+}
+
+/// Index of the pair (i, j), i < j, in the output of diphoton_masses()
+inline size_t diphoton_pair_index(const size_t i, const size_t j, const size_t n) {
+    return i*n - i*(i+1)/2 + (j - i - 1);
+}
+
+/// Masses of all n*(n-1)/2 pairs of photons, ordered (0,1), (0,2), ..., (1,2), ...
+/// for studying pair choices other than the leading two
+inline void diphoton_masses(const std::vector<PhotonDirection>& photons,
+                            std::vector<double>& masses) {
+    const size_t n = photons.size();
+    masses.resize(n < 2 ? 0 : n*(n-1)/2);
+
+    double* out = masses.data();
+    for (size_t i = 0; i < n; i++) {
+        const PhotonDirection& a = photons[i];
+        for (size_t j = i + 1; j < n; j++)
+            *out++ = diphoton_mass(a, photons[j]);
+    }
+}
+
+/// Largest difference in m^2 to GetCorrectedInvMass(), which rounds the
+/// energies and pts to float before building its TLorentzVectors. A relative
+/// error of FLT_EPSILON/2 on each of them moves m^2 by at most about
+/// 2*FLT_EPSILON*(e1 + e2)^2; twice that leaves room for the double rounding.
+inline double root_mass2_tolerance(const double e1, const double e2) {
+    return 4 * FLT_EPSILON * (e1 + e2) * (e1 + e2);
+}
+
+}
+
+#endif
@@ -0,0 +1,131 @@
+#include "read_ahead.h"
+
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <chrono>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+namespace ana {
+
+ReadAhead::ReadAhead(const std::vector<std::string>& paths, const size_t depth,
+                     const uint64_t max_bytes, const uint64_t block_size)
+    : _depth(std::max(depth, size_t(1))),
+      _max_bytes(std::max(max_bytes, block_size)), _block_size(block_size),
+      _consumed(0), _stop(false)
+{
+    uint64_t total = 0;
+    foreach (const auto& path, paths) {
+        struct stat st;
+        // Streams and the like can't be read twice
+        if (stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+            continue;
+        total += st.st_size;
+        _paths.push_back(path);
+        _ids.push_back(std::make_pair(st.st_dev, st.st_ino));
+        _ends.push_back(total);
+    }
+
+    // Without it there is no telling how far ahead we are
+    DIR* fds = opendir("/proc/self/fd");
+    if (!fds) {
+        std::cerr << "Read-ahead disabled: /proc/self/fd is not available" << std::endl;
+        return;
+    }
+    closedir(fds);
+    _thread = std::thread(&ReadAhead::run, this);
+}
+
+ReadAhead::~ReadAhead() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _stopped.notify_all();
+    if (_thread.joinable())
+        _thread.join();
+}
+
+/// Position of the process in the inputs: the offset in the earliest input it
+/// has open, other than through `own_fd`. Between two inputs, and before the
+/// first, the last position found.
+uint64_t ReadAhead::consumed_bytes(const int own_fd) {
+    DIR* fds = opendir("/proc/self/fd");
+    if (!fds)
+        return _consumed;
+    size_t earliest = _paths.size();
+    uint64_t offset = 0;
+    while (const dirent* entry = readdir(fds)) {
+        const int fd = atoi(entry->d_name);
+        struct stat st;
+        if (entry->d_name[0] == '.' || fd == own_fd || fd == dirfd(fds) || fstat(fd, &st) != 0)
+            continue;
+        const auto id = std::make_pair(st.st_dev, st.st_ino);
+        for (size_t i = 0; i < earliest; i++) {
+            if (_ids[i] != id)
+                continue;
+            const off_t position = lseek(fd, 0, SEEK_CUR);
+            earliest = i;
+            offset = position > 0 ? position : 0;
+            break;
+        }
+    }
+    closedir(fds);
+    if (earliest < _paths.size()) {
+        const uint64_t start = earliest ? _ends[earliest - 1] : 0;
+        _consumed = std::max(_consumed, start + offset);
+    }
+    return _consumed;
+}
+
+/// Wait until reading up to `ahead_until` in `file` keeps within the limits.
+/// Returns false when stopped.
+bool ReadAhead::wait_for_room(const size_t file, const int fd, const uint64_t ahead_until, uint64_t& consumed) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_stop) {
+        consumed = consumed_bytes(fd);
+        // With several processing threads this is only the file furthest behind, roughly
+        const size_t current = std::upper_bound(_ends.begin(), _ends.end(), consumed) - _ends.begin();
+        if (file < current + _depth && ahead_until <= consumed + _max_bytes)
+            return true;
+        _stopped.wait_for(lock, std::chrono::milliseconds(20));
+    }
+    return false;
+}
+
+void ReadAhead::run() {
+    std::vector<char> block(_block_size);
+    uint64_t start = 0;
+    for (size_t i = 0; i < _paths.size(); start = _ends[i++]) {
+        const uint64_t size = _ends[i] - start;
+        const int fd = open(_paths[i].c_str(), O_RDONLY);
+        if (fd < 0)
+            continue;
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+        uint64_t offset = 0, consumed = 0;
+        while (offset < size) {
+            if (!wait_for_room(i, fd, start + offset + _block_size, consumed)) {
+                close(fd);
+                return;
+            }
+            // The event loop got (well) ahead, there's no point reading behind it
+            if (start + offset + _block_size < consumed) {
+                offset = std::min(size, consumed - start);
+                continue;
+            }
+            const ssize_t n = pread(fd, &block[0], _block_size, offset);
+            if (n <= 0)
+                break;
+            offset += n;
+        }
+        close(fd);
+    }
+}
+
+}
@@ -0,0 +1,52 @@
+#ifndef _READ_AHEAD_H_
+#define _READ_AHEAD_H_
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <sys/types.h>
+
+#include <a4/types.h>
+
+namespace ana {
+
+/// Reads the input files ahead of the event loop, on a background thread.
+///
+/// a4 reads, decompresses and parses on the processing threads, so every
+/// block fetched from a slow (network) filesystem stalls the analysis. This
+/// thread streams the raw blocks of the upcoming inputs first, so that a4 finds
+/// them in the page cache and the I/O latency overlaps with processing.
+///
+/// It stays at most `depth` files and `max_bytes` ahead of where the process
+/// is reading the inputs itself: the file offsets of its open descriptors on
+/// them, found in /proc/self/fd. Other reads (pileup files, GRL, ...) don't
+/// count. Only one `block_size` buffer is ever held.
+class ReadAhead {
+    std::vector<std::string> _paths;
+    std::vector<std::pair<dev_t, ino_t>> _ids;
+    std::vector<uint64_t> _ends; // cumulative file sizes
+    size_t _depth;
+    uint64_t _max_bytes, _block_size;
+
+    uint64_t _consumed;
+    bool _stop;
+    std::mutex _mutex;
+    std::condition_variable _stopped;
+    std::thread _thread;
+
+    uint64_t consumed_bytes(int own_fd);
+    bool wait_for_room(size_t file, int fd, uint64_t ahead_until, uint64_t& consumed);
+    void run();
+
+public:
+    ReadAhead(const std::vector<std::string>& paths, size_t depth,
+              uint64_t max_bytes, uint64_t block_size = 1 << 20);
+    ~ReadAhead();
+};
+
+}
+
+#endif
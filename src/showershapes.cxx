@@ -0,0 +1,211 @@
+#include "showershapes.h"
+
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+#include <a4/histogram.h>
+using a4::hist::H3;
+#include <a4/axis.h>
+using a4::hist::VariableAxis;
+
+#include "egammaPIDdefs.h"
+
+namespace ana {
+
+#define PT_EDGES  0, 100, 250, 500, 750, 1000, 1500, 2000
+#define ETA_EDGES 0, 0.6, 0.8, 1.15, 1.37, 1.52, 1.81, 2.01, 2.37, 2.47
+
+namespace {
+
+const double pt_edges[]  = { PT_EDGES };
+const double eta_edges[] = { ETA_EDGES };
+
+VariableAxis pt_axis  = VariableAxis({ PT_EDGES });
+VariableAxis eta_axis = VariableAxis({ ETA_EDGES });
+
+// Including underflow and overflow
+const size_t n_pt  = sizeof(pt_edges)  / sizeof(*pt_edges)  + 1;
+const size_t n_eta = sizeof(eta_edges) / sizeof(*eta_edges) + 1;
+
+/// 0 is underflow, N is overflow
+template <size_t N>
+inline size_t find_bin(const double (&edges)[N], const double x) {
+    return std::upper_bound(edges, edges + N, x) - edges;
+}
+
+/// A value which lands in bin i of find_bin()
+template <size_t N>
+inline double bin_centre(const double (&edges)[N], const size_t i) {
+    if (i == 0) return edges[0] - 1;
+    if (i == N) return edges[N-1] + 1;
+    return (edges[i-1] + edges[i]) / 2;
+}
+
+}
+
+struct ShowerShapeBank::Variable {
+    const char* name;
+    unsigned int bins;
+    double min, max;
+    const char* label;
+    int bit; // isEM bit cutting on this variable, -1 for none
+    double (*value)(const ntup::Photon& ph, const ntup::Photon& corrected);
+
+    size_t size() const { return bins + 2; }
+    size_t selections() const { return bit == -1 ? 1 : N_SELECTIONS; }
+
+    size_t bin(const double x) const {
+        if (!(x >= min)) return 0; // Also NaN
+        if (x >= max) return bins + 1;
+        return 1 + size_t((x - min) / (max - min) * bins);
+    }
+
+    double centre(const size_t i) const {
+        const double width = (max - min) / bins;
+        return min + (double(i) - 0.5) * width;
+    }
+};
+
+// Raw quantity from the input, or quantity after fudging
+#define RAW(what)  [](const ntup::Photon& ph, const ntup::Photon&)  -> double { return ph.what(); }
+#define CORR(what) [](const ntup::Photon&,    const ntup::Photon& c) -> double { return c.what(); }
+
+static const ShowerShapeBank::Variable variables[] = {
+    ////
+    // "HADRONIC"
+    ////
+
+    {"Ethad",       100,  -5000.0,  250000.0, "E_{T} had [MeV]",                -1, RAW(ethad)},
+    {"Ethad1",      100,  -4000.0,  160000.0, "E_{T} had (1st layer) [MeV]",    -1, RAW(ethad1)},
+    {"Rhad",        120,     -0.1,      0.75, "R_{had}",             egammaPID::ClusterHadronicLeakage_Photon, CORR(rhad)},
+    {"Rhad1",       120,    -0.01,       0.1, "R_{had} (1st layer)", egammaPID::ClusterHadronicLeakage_Photon, CORR(rhad1)},
+
+    ////
+    // "MIDDLE"
+    ////
+
+    // E237 / E277
+    {"reta",        120,      0.9,         1, "R_{#eta}",            egammaPID::ClusterMiddleEratio37_Photon, CORR(reta)},
+    // E233 / E237
+    {"rphi",        120,      0.8,         1, "R_{#phi}",            egammaPID::ClusterMiddleEratio33_Photon, CORR(rphi)},
+    // Width in second sampling
+    {"weta2",       100,    -0.01,      0.06, "w_{#eta} (2nd sampling)", egammaPID::ClusterMiddleWidth_Photon, CORR(weta2)},
+
+    ////
+    // "STRIPS"
+    ////
+
+    // eratio AKA DEmaxs1
+    {"Eratio",      120,      0.7,         1, "E_{ratio}",           egammaPID::ClusterStripsDEmaxs1_Photon, CORR(eratio)},
+    // Difference of energy between max and min
+    {"DeltaE",       60,        0,       500, "#DeltaE [MeV]",       egammaPID::ClusterStripsDeltaE_Photon, CORR(deltae)},
+    // E of 2nd max in 1st sampling ~e2tsts1/(1000+const_lumi*et), AKA: Rmax
+    // Unused in current LowLumi_Photons menu
+    {"deltaEmax2",  100,        0,       4.0, "#DeltaE_{max}",       egammaPID::ClusterStripsDeltaEmax2_Photon, RAW(deltaemax2)},
+    // "fraction of energy reconstructed in strips"
+    {"f1",          100,    -0.05,      0.85, "f_{1}",               egammaPID::ClusterStripsEratio_Photon, CORR(f1)},
+    {"f1core",      100,        0,       0.6, "f_{1} (core)",                   -1, RAW(f1core)},
+    {"f3core",      100,        0,       1.0, "f_{3} (core)",                   -1, RAW(f3core)},
+    // AKA: fracm
+    {"fside",       100,     -0.1,       2.0, "f_{side}",            egammaPID::ClusterStripsFracm_Photon, CORR(fside)},
+    // "Width in 3 strips", AKA: weta1/weta1c/w1
+    {"ws3",         100,        0,      0.85, "w_{#eta} (1st sampling)", egammaPID::ClusterStripsWeta1c_Photon, CORR(ws3)},
+    // "Total width in strips"
+    {"wstot",       100,     0.04,      20.0, "w_{total} ",          egammaPID::ClusterStripsWtot_Photon, CORR(wstot)},
+
+    ////
+    // "OTHER"
+    ////
+
+    // Energy of minimum in shower
+    {"Emins1",      100,   -500.0,    5000.0, "E_{min} [MeV]",                  -1, RAW(emins1)},
+    // First maximum, finds its way into deltae
+    {"Emaxs1",      100,        0,  110000.0, "E_{max} [MeV]",                  -1, RAW(emaxs1)},
+    // Energy of second maximum between max and min in strips
+    {"Emax2",       100,        0,  151000.0, "E_{second max} [MeV]",           -1, RAW(emax2)},
+    // (e2tsts1 - emins1)
+    {"deltaEs",     100,   -500.0,    5000.0, "#DeltaE_{s} [MeV]",              -1, RAW(deltaes)},
+    {"E233",        100,  -5000.0,  900000.0, "E233 [MeV]",                     -1, RAW(e233)},
+    {"E237",        100, -15000.0,  900000.0, "E237 [MeV]",                     -1, RAW(e237)},
+    {"E277",        100, -28000.0, 1000000.0, "E277 [MeV]",                     -1, RAW(e277)},
+};
+
+#undef RAW
+#undef CORR
+
+static const size_t n_variables = sizeof(variables) / sizeof(*variables);
+
+ShowerShapeBank::ShowerShapeBank() : _cell_size(0), _empty(true) {
+    for (size_t i = 0; i < n_variables; i++) {
+        _offsets.push_back(_cell_size);
+        _cell_size += variables[i].selections() * variables[i].size();
+    }
+    _bins.assign(n_eta * n_pt * _cell_size, SparseBin());
+}
+
+void ShowerShapeBank::fill(const ntup::Photon& ph, const ntup::Photon& corrected, const double weight) {
+    const size_t ipt = find_bin(pt_edges, corrected.pt() / 1000),
+                 ieta = find_bin(eta_edges, fabs(corrected.etas2()));
+
+    SparseBin* const cell = &_bins[(ieta * n_pt + ipt) * _cell_size];
+    const double weight2 = weight * weight;
+    const unsigned int isem = corrected.isem();
+
+    for (size_t i = 0; i < n_variables; i++) {
+        const Variable& v = variables[i];
+        SparseBin* const h = cell + _offsets[i];
+        const size_t b = v.bin(v.value(ph, corrected));
+
+        h[ALL * v.size() + b].w += weight;
+        h[ALL * v.size() + b].w2 += weight2;
+        if (v.bit != -1) {
+            const Selection s = (isem & (1u << v.bit)) ? FAIL : PASS;
+            h[s * v.size() + b].w += weight;
+            h[s * v.size() + b].w2 += weight2;
+        }
+    }
+    _empty = false;
+}
+
+void ShowerShapeBank::flush(ObjectStore D) {
+    if (_empty)
+        return;
+
+    static const char* const prefix[N_SELECTIONS] = { "", "pass/", "fail/" };
+    D = D("showershapes/");
+
+    for (size_t ieta = 0; ieta < n_eta; ieta++)
+    for (size_t ipt = 0; ipt < n_pt; ipt++) {
+        const SparseBin* const cell = &_bins[(ieta * n_pt + ipt) * _cell_size];
+        const double pt = bin_centre(pt_edges, ipt), eta = bin_centre(eta_edges, ieta);
+
+        for (size_t i = 0; i < n_variables; i++) {
+            const Variable& v = variables[i];
+            for (size_t s = 0; s < v.selections(); s++) {
+                const SparseBin* const h = cell + _offsets[i] + s * v.size();
+                for (size_t b = 0; b < v.size(); b++) {
+                    if (h[b].w2 == 0)
+                        continue;
+                    uint32_t k; double a, last;
+                    equivalent_fills(h[b], k, a, last);
+
+                    D.set_weight(a);
+                    auto& hist = D.T<H3>(std::string(prefix[s]) + v.name)(v.bins, v.min, v.max, v.label)
+                        .with_axis(pt_axis, "p_{T} [GeV]")
+                        .with_axis(eta_axis, "#eta_{second layer}");
+                    for (uint32_t n = 0; n < k; n++)
+                        hist.fill(v.centre(b), pt, eta);
+
+                    D.set_weight(last);
+                    D.T<H3>(std::string(prefix[s]) + v.name).fill(v.centre(b), pt, eta);
+                }
+            }
+        }
+    }
+
+    std::fill(_bins.begin(), _bins.end(), SparseBin());
+    _empty = true;
+}
+
+}
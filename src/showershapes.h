@@ -0,0 +1,54 @@
+#ifndef _SHOWERSHAPES_H_
+#define _SHOWERSHAPES_H_
+
+#include <vector>
+
+#include <a4/application.h>
+using a4::store::ObjectStore;
+
+#include <a4/atlas/ntup/photon/Event.pb.h>
+
+#include "sparse_histogram.h"
+
+namespace ana {
+
+namespace ntup = a4::atlas::ntup::photon;
+
+/// Shower shape monitoring: a (value, p_T, |eta_s2|) histogram per shower
+/// shape variable, for all photons and split into pass/ and fail/ on the
+/// variable's own isEM bit.
+///
+/// Every bin of every variable lives in one contiguous block, ordered by
+/// (eta, pt) cell first so that a photon only touches one region of memory.
+/// fill() looks up the pt and eta bins once and then makes a single pass over
+/// the variables, which is cheap enough to run on every tight photon.
+/// flush() turns the block into H3s and resets it.
+class ShowerShapeBank {
+public:
+    struct Variable;
+
+    ShowerShapeBank();
+
+    /// `ph` is the photon as read, `corrected` its compute_corrections() result
+    void fill(const ntup::Photon& ph, const ntup::Photon& corrected, const double weight);
+
+    /// Write the accumulated histograms under D("showershapes/").
+    /// Each bin keeps its sum of weights and of squared weights, and is
+    /// refilled at its centre with the equivalent_fills() of those, so both
+    /// contents and errors are those of filling the H3s directly.
+    void flush(ObjectStore D);
+
+    bool empty() const { return _empty; }
+
+private:
+    enum Selection { ALL, PASS, FAIL, N_SELECTIONS };
+
+    std::vector<SparseBin> _bins;
+    std::vector<size_t> _offsets;   // of each variable within a cell
+    size_t _cell_size;              // all variables for one (eta, pt) cell
+    bool _empty;
+};
+
+}
+
+#endif
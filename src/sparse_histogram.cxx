@@ -0,0 +1,74 @@
+#include "sparse_histogram.h"
+
+#include <math.h>
+
+#include <a4/histogram.h>
+using a4::hist::H1;
+using a4::hist::H2;
+
+namespace ana {
+
+void equivalent_fills(const SparseBin& bin, uint32_t& k, double& a, double& b) {
+    const double S = bin.w, Q = bin.w2;
+    k = 0; a = 0; b = S;
+    if (Q <= 0)
+        return;
+
+    // k weights a plus one weight b reproduce (S, Q) iff (k + 1) Q >= S^2
+    const double n_eff = S*S / Q;
+    k = n_eff > 1 ? uint32_t(ceil(n_eff - 1 - 1e-9)) : 0;
+    if (k == 0 && Q > S*S * (1 + 1e-12))
+        k = 1; // e.g. mixed sign weights summing to zero
+    if (k == 0)
+        return;
+
+    const double disc = k * ((1 + k) * Q - S*S);
+    a = (k*S + sqrt(disc > 0 ? disc : 0)) / (k * (1 + k));
+    b = S - k*a;
+}
+
+void SparseH1::write(ObjectStore D, const std::string& name) const {
+    foreach (const auto& i, _contents) {
+        const double x = _x.centre(i.first);
+        uint32_t k; double a, b;
+        equivalent_fills(i.second, k, a, b);
+
+        D.set_weight(a);
+        auto& h = D.T<H1>(name)(_x.bins, _x.min, _x.max, _x.label.c_str());
+        for (uint32_t n = 0; n < k; n++)
+            h.fill(x);
+
+        D.set_weight(b);
+        D.T<H1>(name).fill(x);
+    }
+}
+
+void SparseH2::write(ObjectStore D, const std::string& name) const {
+    foreach (const auto& i, _contents) {
+        const double x = _x.centre(i.first >> 32),
+                     y = _y.centre(i.first & 0xffffffff);
+        uint32_t k; double a, b;
+        equivalent_fills(i.second, k, a, b);
+
+        D.set_weight(a);
+        auto& h = D.T<H2>(name)
+            (_x.bins, _x.min, _x.max, _x.label.c_str())
+            (_y.bins, _y.min, _y.max, _y.label.c_str());
+        for (uint32_t n = 0; n < k; n++)
+            h.fill(x, y);
+
+        D.set_weight(b);
+        D.T<H2>(name).fill(x, y);
+    }
+}
+
+void SparseStore::flush(ObjectStore D) {
+    foreach (const auto& i, _h1)
+        i.second.write(D, i.first);
+    foreach (const auto& i, _h2)
+        i.second.write(D, i.first);
+    _h1.clear();
+    _h2.clear();
+}
+
+}
@@ -0,0 +1,118 @@
+#ifndef _SPARSE_HISTOGRAM_H_
+#define _SPARSE_HISTOGRAM_H_
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <a4/application.h>
+using a4::store::ObjectStore;
+
+namespace ana {
+
+struct SparseBin {
+    double w, w2;
+    SparseBin() : w(0), w2(0) {}
+};
+
+/// Uniform axis, bin 0 is underflow and bins+1 overflow
+struct SparseAxis {
+    uint32_t bins;
+    double min, max;
+    std::string label;
+
+    SparseAxis(const uint32_t bins, const double min, const double max, const char* label)
+        : bins(bins), min(min), max(max), label(label) {}
+
+    uint32_t find_bin(const double x) const {
+        if (!(x >= min)) return 0;
+        if (x >= max) return bins + 1;
+        return 1 + uint32_t((x - min) / (max - min) * bins);
+    }
+
+    double centre(const uint32_t i) const {
+        return min + (double(i) - 0.5) * (max - min) / bins;
+    }
+};
+
+/// Histograms which only store their non-empty bins, in a hash table.
+///
+/// Meant for bookings with thousands of bins of which a handful get filled,
+/// e.g. eff/mgg_true/* with one 7000 bin histogram per cut stage. They are
+/// only expanded into regular a4 histograms by write().
+class SparseH1 {
+    SparseAxis _x;
+    std::unordered_map<uint32_t, SparseBin> _contents;
+
+public:
+    SparseH1(const uint32_t bins, const double min, const double max, const char* label)
+        : _x(bins, min, max, label) {}
+
+    void fill(const double x, const double w) {
+        auto& bin = _contents[_x.find_bin(x)];
+        bin.w += w;
+        bin.w2 += w*w;
+    }
+
+    size_t filled_bins() const { return _contents.size(); }
+    void write(ObjectStore D, const std::string& name) const;
+};
+
+class SparseH2 {
+    SparseAxis _x, _y;
+    std::unordered_map<uint64_t, SparseBin> _contents;
+
+public:
+    SparseH2(const uint32_t xbins, const double xmin, const double xmax, const char* xlabel,
+             const uint32_t ybins, const double ymin, const double ymax, const char* ylabel)
+        : _x(xbins, xmin, xmax, xlabel), _y(ybins, ymin, ymax, ylabel) {}
+
+    void fill(const double x, const double y, const double w) {
+        const uint64_t key = uint64_t(_x.find_bin(x)) << 32 | _y.find_bin(y);
+        auto& bin = _contents[key];
+        bin.w += w;
+        bin.w2 += w*w;
+    }
+
+    size_t filled_bins() const { return _contents.size(); }
+    void write(ObjectStore D, const std::string& name) const;
+};
+
+/// Named sparse histograms, with the same relative paths as an ObjectStore
+class SparseStore {
+    std::unordered_map<std::string, SparseH1> _h1;
+    std::unordered_map<std::string, SparseH2> _h2;
+
+public:
+    SparseH1& h1(const std::string& name,
+                 const uint32_t bins, const double min, const double max, const char* label="") {
+        auto i = _h1.find(name);
+        if (i == _h1.end())
+            i = _h1.insert(std::make_pair(name, SparseH1(bins, min, max, label))).first;
+        return i->second;
+    }
+
+    SparseH2& h2(const std::string& name,
+                 const uint32_t xbins, const double xmin, const double xmax, const char* xlabel,
+                 const uint32_t ybins, const double ymin, const double ymax, const char* ylabel) {
+        auto i = _h2.find(name);
+        if (i == _h2.end())
+            i = _h2.insert(std::make_pair(name, SparseH2(xbins, xmin, xmax, xlabel,
+                                                         ybins, ymin, ymax, ylabel))).first;
+        return i->second;
+    }
+
+    bool empty() const { return _h1.empty() && _h2.empty(); }
+
+    /// Expand everything into dense histograms in D and forget it
+    void flush(ObjectStore D);
+};
+
+/// Weights {a (k times), b} whose sum is w and sum of squares is w2, so that a
+/// dense histogram refilled with them has the same content and error as the
+/// sparse bin. k + 1 is the number of effective entries, rounded up.
+void equivalent_fills(const SparseBin& bin, uint32_t& k, double& a, double& b);
+
+}
+
+#endif
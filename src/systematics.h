@@ -0,0 +1,105 @@
+#ifndef _SYSTEMATICS_H_
+#define _SYSTEMATICS_H_
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include <a4/application.h>
+using a4::store::ObjectStore;
+
+#include "sparse_histogram.h"
+
+namespace ana {
+
+/// Weight-only systematic variations, evaluated in a single pass.
+///
+/// Index 0 is the nominal store, each declared variation gets its own store
+/// under "syst/<name>/". Everything that changes the event weight goes through
+/// here, so a variation only differs from nominal by the factors applied to
+/// it individually. Filling all stores() costs one fill per variation instead
+/// of replaying the whole event through rerun_systematics.
+/// Each variation also has a SparseStore for large, mostly empty histograms,
+/// separately for every pass through the events (nominal and each of the
+/// rerun_systematics), since those fill different stores.
+class WeightSystematics {
+public:
+    typedef size_t Index;
+    static const Index NOMINAL = 0;
+    static const Index NONE = Index(-1);
+
+private:
+    std::vector<std::string> _names, _prefixes;
+    std::vector<ObjectStore> _stores;
+
+    /// The sparse histograms of one pass, and the store they belong to
+    struct SparsePass {
+        ObjectStore S;
+        std::vector<SparseStore> sparse;
+    };
+    std::map<std::string, SparsePass> _passes;
+    SparsePass* _pass;
+
+public:
+    WeightSystematics() : _names(1, "nominal"), _prefixes(1, ""), _stores(1), _pass(NULL) {}
+
+    Index declare(const std::string& name) {
+        _names.push_back(name);
+        _prefixes.push_back("syst/" + name + "/");
+        _stores.resize(_names.size());
+        return _names.size() - 1;
+    }
+
+    size_t size() const { return _names.size(); }
+    const std::string& name(Index i) const { return _names[i]; }
+
+    /// Rebind all variations to the processor's store at the start of an event
+    /// of the given pass, "" for nominal
+    void bind(const ObjectStore& S, const std::string& pass) {
+        _stores[NOMINAL] = S;
+        for (Index i = 1; i < _stores.size(); i++)
+            _stores[i] = _stores[NOMINAL](_prefixes[i]);
+
+        _pass = &_passes[pass];
+        _pass->S = S;
+        if (_pass->sparse.empty())
+            _pass->sparse.resize(_names.size());
+    }
+
+    void set_weight(const double w) {
+        foreach (auto& D, _stores)
+            D.set_weight(w);
+    }
+
+    void mul_weight(const double w) {
+        foreach (auto& D, _stores)
+            D.mul_weight(w);
+    }
+
+    /// Apply `w` to variation i only. NONE is silently ignored so that callers
+    /// needn't care whether a variation was declared.
+    void mul_weight(const Index i, const double w) {
+        if (i != NONE)
+            _stores[i].mul_weight(w);
+    }
+
+    ObjectStore& nominal() { return _stores[NOMINAL]; }
+    std::vector<ObjectStore>& stores() { return _stores; }
+    SparseStore& sparse(const Index i) { return _pass->sparse[i]; }
+    
+    /// Write out the sparse histograms of every pass and variation as dense
+    /// ones, each into the store of the pass which filled it
+    void flush_sparse() {
+        foreach (auto& p, _passes) {
+            for (Index i = 0; i < p.second.sparse.size(); i++) {
+                if (p.second.sparse[i].empty())
+                    continue;
+                p.second.sparse[i].flush(i == NOMINAL ? p.second.S : p.second.S(_prefixes[i]));
+            }
+        }
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,145 @@
+// m_gg from kinematics.h against the TLorentzVector implementation in
+// external.cxx (GetCorrectedInvMass), over barrel and endcap, converted and
+// unconverted photon pairs. Then the batched diphoton_masses against
+// diphoton_mass for every pair of events with up to 8 photons.
+//
+// Besides GetCorrectedInvMass, which rounds energies and pts to float, the
+// kernel is compared to the same computation done in double precision. That
+// still takes the calorimeter radius from ReturnRZ_1stSampling_cscopt2, which
+// evaluates it at a float |eta|, so they agree to 1e-9 rather than to rounding.
+
+#include <cstdio>
+#include <cmath>
+#include <vector>
+
+#include <TLorentzVector.h>
+#include <TRandom3.h>
+
+#include "external.h"
+#include "kinematics.h"
+
+using ana::PhotonDirection;
+using ana::diphoton_mass;
+using ana::diphoton_masses;
+using ana::diphoton_pair_index;
+using ana::root_mass2_tolerance;
+
+/// GetCorrectedInvMass without the float intermediates
+double root_mass_double(double e1, double eta1, double phi1,
+                        double e2, double eta2, double phi2, double z) {
+    double eta[2] = {eta1, eta2};
+    for (int i = 0; i < 2; i++) {
+        double R, Z;
+        if (fabs(eta[i]) < 1.5) {
+            R = ReturnRZ_1stSampling_cscopt2(eta[i]);
+            Z = R * sinh(eta[i]);
+        } else {
+            Z = ReturnRZ_1stSampling_cscopt2(eta[i]);
+            R = Z / sinh(eta[i]);
+        }
+        eta[i] = asinh((Z - z) / R);
+    }
+    TLorentzVector v1, v2;
+    v1.SetPtEtaPhiE(e1 / cosh(eta[0]), eta[0], phi1, e1);
+    v2.SetPtEtaPhiE(e2 / cosh(eta[1]), eta[1], phi2, e2);
+    return (v1 + v2).M();
+}
+
+struct Region {
+    const char* name;
+    double eta_min, eta_max;
+};
+
+int main() {
+    // Away from 1.5, where ReturnRZ_1stSampling_cscopt2 decides the region
+    // on a float |eta| and GetCorrectedInvMass on a double one
+    const Region regions[] = {
+        {"barrel", 0, 1.37},
+        {"endcap", 1.52, 2.37},
+    };
+    const char* conversions[] = {"UNCONVERTED_PHOTON", "CONVERTED_PHOTON"};
+
+    EnergyRescaler rescaler;
+    rescaler.useDefaultCalibConstants("2011");
+
+    TRandom3 random(4242);
+    const int pairs = 100000;
+    int failures = 0;
+
+    for (int r1 = 0; r1 < 2; r1++)
+    for (int r2 = r1; r2 < 2; r2++)
+    for (int c1 = 0; c1 < 2; c1++)
+    for (int c2 = 0; c2 < 2; c2++) {
+        double worst_root = 0, worst_double = 0;
+        for (int n = 0; n < pairs; n++) {
+            double e[2], eta[2], phi[2];
+            const Region* region[2] = {&regions[r1], &regions[r2]};
+            const char* type[2] = {conversions[c1], conversions[c2]};
+            for (int i = 0; i < 2; i++) {
+                eta[i] = random.Uniform(region[i]->eta_min, region[i]->eta_max);
+                if (random.Uniform() < 0.5) eta[i] = -eta[i];
+                phi[i] = random.Uniform(-M_PI, M_PI);
+                // Cluster energy for 25 GeV to 3 TeV pt, with the energy
+                // scale correction of the photon type
+                const double et = 25e3 * exp(random.Uniform(0, log(120.)));
+                const double cl_e = et * cosh(eta[i]);
+                e[i] = rescaler.applyEnergyCorrectionMeV(eta[i], phi[i], cl_e, et,
+                                                         EnergyRescaler::NOMINAL, type[i]);
+            }
+            // Mostly back to back, sometimes nearly collinear
+            if (n % 10 == 0) {
+                phi[1] = phi[0] + random.Gaus(0, 0.05);
+                eta[1] = eta[0] + random.Gaus(0, 0.05);
+            }
+            const double z = random.Gaus(0, 56);
+
+            const double m = diphoton_mass(PhotonDirection(e[0], eta[0], phi[0], z),
+                                           PhotonDirection(e[1], eta[1], phi[1], z));
+            const double m_root = GetCorrectedInvMass(e[0], eta[0], phi[0], e[1], eta[1], phi[1], z);
+            const double m_double = root_mass_double(e[0], eta[0], phi[0], e[1], eta[1], phi[1], z);
+
+            const double scale = (e[0] + e[1]) * (e[0] + e[1]);
+            const double d_root = fabs(m*m - m_root*m_root);
+            const double d_double = fabs(m*m - m_double*m_double);
+            worst_root = std::max(worst_root, d_root / scale);
+            worst_double = std::max(worst_double, d_double / scale);
+
+            if (d_root > root_mass2_tolerance(e[0], e[1]) || d_double > 1e-9 * scale) {
+                if (failures++ < 10)
+                    printf("FAIL m=%.6f root=%.6f double=%.6f (E %g %g, eta %g %g, phi %g %g, z %g)\n",
+                           m, m_root, m_double, e[0], e[1], eta[0], eta[1], phi[0], phi[1], z);
+            }
+        }
+        printf("%s/%s %s/%s: max |dm^2|/(E1+E2)^2 %.2e (TLorentzVector), %.2e (double)\n",
+               regions[r1].name, regions[r2].name, conversions[c1], conversions[c2],
+               worst_root, worst_double);
+    }
+
+    // All pairs, in the order of diphoton_pair_index
+    int pair_failures = 0;
+    std::vector<PhotonDirection> photons;
+    std::vector<double> masses;
+    for (int n = 0; n < 10000; n++) {
+        const size_t count = n % 9;
+        const double z = random.Gaus(0, 56);
+        photons.clear();
+        for (size_t i = 0; i < count; i++)
+            photons.push_back(PhotonDirection(25e3 * exp(random.Uniform(0, log(120.))),
+                                              random.Uniform(-2.37, 2.37),
+                                              random.Uniform(-M_PI, M_PI), z));
+        diphoton_masses(photons, masses);
+        if (masses.size() != (count < 2 ? 0 : count * (count - 1) / 2)) {
+            pair_failures++;
+            continue;
+        }
+        for (size_t i = 0; i < count; i++)
+        for (size_t j = i + 1; j < count; j++)
+            if (masses[diphoton_pair_index(i, j, count)] != diphoton_mass(photons[i], photons[j]))
+                pair_failures++;
+    }
+    printf("all pairs: %d failures\n", pair_failures);
+    failures += pair_failures;
+
+    printf("%d failures\n", failures);
+    return failures ? 1 : 0;
+}